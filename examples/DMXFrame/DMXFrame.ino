@@ -0,0 +1,83 @@
+/**
+ * @file DMXFrame.ino
+ * @author Christian Neukam
+ * @brief MidiDmxBridge library example to demonstrate the DMX512 frame output.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <MidiDmxBridge.h>
+
+#if defined(USBCON)
+#define ArduinoSerial Serial1 /**< Leonardo, Due and other USB boards use Serial1 by default. */
+#else
+#define ArduinoSerial Serial /**< Other boards use Serial instead. */
+#endif
+
+#define kDmxTxPin 1    /**< the UART TX pin driving the DMX line driver */
+#define kDmxSlots 32   /**< the number of DMX slots to transmit */
+#define kMidiChannel 1 /**< the MIDI channel to listen to in the range [1, 16] */
+
+static DmxFrame frame(kDmxSlots);  /**< the transmit-ready DMX512 frame */
+static SerialReaderDefault reader; /**< the default mididmxbridge::ISerialReader */
+
+/**
+ * @brief The MidiDmxBridge object writing the DMX values directly into the DMX512 frame.
+ *
+ * The frame is used as compile-time output sink, so no callback is required.
+ *
+ */
+static BasicMidiDmxBridge<ChannelSink<DmxFrame>> MDXBridge(kMidiChannel, frame, reader);
+
+/**
+ * @brief Transmit the DMX512 frame via the UART.
+ *
+ * The break and the mark-after-break are generated by driving the TX pin directly. The frame
+ * itself is handed over to the interrupt-driven UART transmit buffer at once, so the transmission
+ * continues in the background while the next MIDI data is processed.
+ *
+ */
+static void transmitFrame() {
+  ArduinoSerial.flush();  // wait for the previous frame
+  ArduinoSerial.end();
+
+  pinMode(kDmxTxPin, OUTPUT);
+  digitalWrite(kDmxTxPin, LOW);
+  delayMicroseconds(frame.breakTime());
+  digitalWrite(kDmxTxPin, HIGH);
+  delayMicroseconds(frame.mabTime());
+
+  ArduinoSerial.begin(250000, SERIAL_8N2);
+  ArduinoSerial.write(frame.data(), frame.size());
+}
+
+/**
+ * @brief Setup the Arduino board.
+ *
+ */
+void setup() {
+  ArduinoSerial.begin(250000, SERIAL_8N2);
+  MDXBridge.begin();
+}
+
+/**
+ * @brief Main processing loop.
+ *
+ */
+void loop() {
+  MDXBridge.listen();
+  transmitFrame();
+}
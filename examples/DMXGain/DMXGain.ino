@@ -43,29 +43,50 @@ class SerialReader : public mididmxbridge::ISerialReader {
   uint8_t idx = 0;                            /**< pointer to data */
 };
 
+#define kMidiChannel 1           /**< the MIDI channel to listen to in the range [1, 16] */
+#define kCycleTime 1000          /**< the time in ms to display one DMX value via the LED */
+static SerialReader reader;      /**< the implementation of mididmxbridge::ISerialReader */
+static DmxWriteQueue<8> queue;   /**< the queue decoupling the DMX output from the processing */
+static BasicMidiDmxBridge<WriterSink> MDXBridge(kMidiChannel, queue, reader); /**< the bridge */
+static uint16_t gain = 200;      /**< initial DMX gain value, the valid range is [0, 1023] */
+static uint8_t ledValue = 0;     /**< the DMX value currently displayed via the LED */
+static unsigned long ledStart;   /**< the start time of the current LED cycle in ms */
+static bool isLedActive = false; /**< true while a DMX value is displayed */
+
 /**
- * @brief Implementation of the callback mididmxbridge::dmx::DmxOnChangeCallback.
+ * @brief Write operation of the DMX values queued by the MidiDmxBridge object.
  *
- * This callback is always called as soon as a new DMX date is generated from a
- * different MIDI CC signal. The built-in LED lights up for different lengths of time depending on
- * the set gain value. The DMX data can then be sent further via a DMX library, e.g. DMXSerial.
+ * This function is called from loop() for every DMX value taken from the queue, i.e. it never
+ * delays the MIDI processing. The built-in LED lights up for different lengths of time depending
+ * on the set gain value. The DMX data can then be sent further via a DMX library, e.g. DMXSerial.
  *
  * @see https://www.arduino.cc/reference/en/libraries/dmxserial/
  *
- * @param[in] channel the DMX channel in the range [1, 255]
+ * @param[in] channel the DMX channel
  * @param[in] value the DMX value in the range [1, 255]
  */
-void onDmxChange(const uint8_t channel, const uint8_t value) {
-  digitalWrite(LED_BUILTIN, HIGH);
-  delay(value * 4);  // light up the LED
-  digitalWrite(LED_BUILTIN, LOW);
-  delay(1000 - value * 4);  // switch off the LED until 1s is reached
+void writeDmx(const uint16_t channel, const uint8_t value) {
+  ledValue = value;
+  ledStart = millis();
+  isLedActive = true;
 }
 
-#define kMidiChannel 1      /**< the MIDI channel to listen to in the range [1, 16] */
-static SerialReader reader; /**< the implementation of mididmxbridge::ISerialReader */
-static MidiDmxBridge MDXBridge(kMidiChannel, onDmxChange, reader); /**< the MidiDmxBridge object */
-static uint16_t gain = 200; /**< initial DMX gain value, the valid range is [0, 1023] */
+/**
+ * @brief Display the queued DMX values one after another via the built-in LED without blocking.
+ *
+ */
+void updateLed() {
+  if (isLedActive && (millis() - ledStart >= kCycleTime)) {
+    isLedActive = false;
+  }
+
+  if (!isLedActive) {
+    queue.drain(writeDmx, 1);
+  }
+
+  // light up the LED proportional to the DMX value, switch it off until the cycle time is reached
+  digitalWrite(LED_BUILTIN, (isLedActive && (millis() - ledStart < ledValue * 4UL)) ? HIGH : LOW);
+}
 
 /**
  * @brief Setup the Arduino board.
@@ -81,11 +102,15 @@ void setup() {
  *
  */
 void loop() {
-  MDXBridge.setAttenuation(gain);
-  MDXBridge.listen();
+  if (queue.isEmpty()) {
+    MDXBridge.setAttenuation(gain);
 
-  gain += 200;
-  if (gain > 800) {
-    gain = 200;
+    gain += 200;
+    if (gain > 800) {
+      gain = 200;
+    }
   }
+
+  MDXBridge.listen();  // also resends the DMX values dropped due to the full queue
+  updateLed();
 }
@@ -0,0 +1,189 @@
+/**
+ * @file gainbench.cpp
+ * @author Christian Neukam
+ * @brief Host benchmark of the universe gain kernels
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * Build and usage on a host system, from the repository root:
+ *
+ *   g++ -std=c++17 -O2 -Isrc -Isrc/midi_dmx extras/gainbench/gainbench.cpp \
+ *       src/midi_dmx/GainKernel.cpp -o gainbench
+ *   ./gainbench [rounds]
+ *
+ * Each implementation of mididmxbridge::dmx::scaleUniverse() is first checked against
+ * mididmxbridge::dmx::scaleValue() bit for bit, for all gains and for odd universe sizes. Then the
+ * implementations scale a set of 512-slot universes for the given number of rounds, the speedup is
+ * reported relative to a plain loop over scaleValue(). Implementations not supported by the build
+ * or the CPU are skipped.
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "GainKernel.h"
+
+using namespace mididmxbridge;
+using namespace mididmxbridge::dmx;
+
+namespace {
+const uint16_t kSlots = 512;      /**< the number of DMX values per universe */
+const uint16_t kUniverses = 32;   /**< the number of universes scaled per round */
+const uint16_t kGain = 700;       /**< the gain of the benchmark, below unity */
+const long kDefaultRounds = 20000; /**< the default number of benchmark rounds */
+
+/**
+ * @brief The implementations of the benchmark.
+ *
+ */
+struct Kernel {
+  const char* name;    /**< the name of the implementation */
+  GainKernelType type; /**< the implementation */
+};
+
+const Kernel kKernels[] = {
+    {"scalar", kGainKernelScalar},
+    {"sse2", kGainKernelSse2},
+    {"avx2", kGainKernelAvx2},
+};
+
+/**
+ * @brief Scale the universe via the reference implementation.
+ *
+ * @param[in] input the raw DMX values
+ * @param[out] output the scaled DMX values
+ * @param[in] size the number of DMX values to scale
+ * @param[in] gain the integer based gain in the range [0, ::kUnityGainValue]
+ */
+void scaleReference(const uint8_t* input, uint8_t* output, const uint16_t size,
+                    const uint16_t gain) {
+  for (uint16_t idx = 0; idx < size; idx++) {
+    output[idx] = scaleValue(input[idx], gain);
+  }
+}
+
+/**
+ * @brief Check the implementation against the reference for all gains and odd sizes.
+ *
+ * @param[in] type the implementation to check
+ * @return true - the implementation is bit-exact to scaleValue()
+ * @return false - otherwise
+ */
+bool verify(const GainKernelType type) {
+  std::vector<uint8_t> input(kSlots);
+  std::vector<uint8_t> expected(kSlots);
+  std::vector<uint8_t> output(kSlots);
+  bool isExact = true;
+
+  for (uint16_t idx = 0; idx < kSlots; idx++) {
+    input[idx] = (uint8_t)(idx * 7 + (idx >> 8));
+  }
+
+  for (uint16_t gain = 0; isExact && (gain <= kUnityGainValue); gain++) {
+    for (uint16_t size : {(uint16_t)kSlots, (uint16_t)(kSlots - 1), (uint16_t)47, (uint16_t)1}) {
+      scaleReference(input.data(), expected.data(), size, gain);
+      scaleUniverseVia(type, input.data(), output.data(), size, gain);
+
+      for (uint16_t idx = 0; isExact && (idx < size); idx++) {
+        isExact = (output[idx] == expected[idx]);
+        if (!isExact) {
+          std::printf("  mismatch: gain %u size %u slot %u: %u instead of %u\n", gain, size, idx,
+                      output[idx], expected[idx]);
+        }
+      }
+    }
+  }
+
+  return isExact;
+}
+
+/**
+ * @brief Measure the time per universe of the function.
+ *
+ * @tparam F the type of the function called via `scale(input, output)` per universe
+ * @param[in] rounds the number of benchmark rounds
+ * @param[in] scale the function scaling one universe
+ * @return double - the time per universe in ns
+ */
+template <class F>
+double measure(const long rounds, F scale) {
+  static std::vector<uint8_t> input(kSlots * kUniverses);
+  static std::vector<uint8_t> output(kSlots * kUniverses);
+  unsigned checksum = 0;
+
+  for (size_t idx = 0; idx < input.size(); idx++) {
+    input[idx] = (uint8_t)std::rand();
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+
+  for (long round = 0; round < rounds; round++) {
+    for (uint16_t universe = 0; universe < kUniverses; universe++) {
+      scale(&input[universe * kSlots], &output[universe * kSlots]);
+    }
+    checksum += output[round % output.size()];
+  }
+
+  const auto stop = std::chrono::steady_clock::now();
+  const double elapsed = std::chrono::duration<double, std::nano>(stop - start).count();
+
+  // the checksum keeps the compiler from dropping the scaled output
+  if (checksum == 0xffffffffu) {
+    std::printf("\n");
+  }
+
+  return elapsed / ((double)rounds * kUniverses);
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const long rounds = (argc > 1) ? std::atol(argv[1]) : kDefaultRounds;
+  int returnValue = 0;
+
+  if (rounds <= 0) {
+    std::fprintf(stderr, "usage: %s [rounds]\n", argv[0]);
+    returnValue = 1;
+  } else {
+    const double reference = measure(rounds, [](const uint8_t* input, uint8_t* output) {
+      scaleReference(input, output, kSlots, kGain);
+    });
+
+    std::printf("%-10s %10s %8s  %s\n", "kernel", "ns/univ", "speedup", "bit-exact");
+    std::printf("%-10s %10.1f %7.2fx  %s\n", "scaleValue", reference, 1.0, "reference");
+
+    for (const Kernel& kernel : kKernels) {
+      uint8_t probe = 0;
+
+      if (!scaleUniverseVia(kernel.type, &probe, &probe, 1, kGain)) {
+        std::printf("%-10s %10s %8s  %s\n", kernel.name, "-", "-", "not supported");
+      } else {
+        const bool isExact = verify(kernel.type);
+        const double time = measure(rounds, [&kernel](const uint8_t* input, uint8_t* output) {
+          scaleUniverseVia(kernel.type, input, output, kSlots, kGain);
+        });
+
+        std::printf("%-10s %10.1f %7.2fx  %s\n", kernel.name, time, reference / time,
+                    isExact ? "yes" : "NO");
+        returnValue |= isExact ? 0 : 1;
+      }
+    }
+  }
+
+  return returnValue;
+}
@@ -0,0 +1,237 @@
+/**
+ * @file showc.cpp
+ * @author Christian Neukam
+ * @brief Host tool compiling a text show description into a binary show file
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * Build and usage on a host system, from the repository root:
+ *
+ *   g++ -std=c++17 -Isrc -Isrc/midi_dmx extras/showc/showc.cpp src/midi_dmx/ShowFile.cpp \
+ *       src/midi_dmx/DmxValue.cpp -o showc
+ *   ./showc show.txt show.mdxs
+ *
+ * The text description holds one statement per line, '#' starts a comment:
+ *
+ *   curve <channel> <linear|gamma|square|scurve>   assign a response curve to a DMX channel
+ *   scene                                          start the next scene
+ *   <channel> <value>                              add a DMX value to the current scene
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ShowFile.h"
+
+using mididmxbridge::dmx::DmxCurve;
+using mididmxbridge::dmx::ShowFile;
+
+namespace {
+/**
+ * @brief A DMX value of a scene.
+ *
+ */
+struct Record {
+  uint16_t channel; /**< the DMX channel */
+  uint8_t value;    /**< the DMX value */
+};
+
+/**
+ * @brief The parsed show description.
+ *
+ */
+struct Show {
+  std::vector<std::vector<Record>> scenes; /**< the DMX values per scene */
+  std::vector<uint8_t> curves;             /**< the response curve per DMX channel */
+};
+
+/**
+ * @brief Parse a response curve name.
+ *
+ * @param[in] name the name of the response curve
+ * @param[out] curve the response curve
+ * @return true - the name is valid
+ * @return false - otherwise
+ */
+bool parseCurve(const std::string& name, DmxCurve& curve) {
+  static const char* const kNames[] = {"linear", "gamma", "square", "scurve"};
+  bool returnValue = false;
+
+  for (uint8_t idx = 0; !returnValue && (idx < 4); idx++) {
+    if (name == kNames[idx]) {
+      curve = static_cast<DmxCurve>(idx);
+      returnValue = true;
+    }
+  }
+
+  return returnValue;
+}
+
+/**
+ * @brief Parse the text show description.
+ *
+ * @param[in] input the text show description
+ * @param[out] show the parsed show description
+ * @return true - the description got parsed
+ * @return false - a syntax error was reported
+ */
+bool parse(std::istream& input, Show& show) {
+  std::string line;
+  bool returnValue = true;
+
+  for (unsigned lineNumber = 1; returnValue && std::getline(input, line); lineNumber++) {
+    std::istringstream statement(line.substr(0, line.find('#')));
+    std::string token;
+
+    if (!(statement >> token)) {
+      continue;
+    }
+
+    unsigned long channel = 0;
+    unsigned long value = 0;
+    std::string name;
+    DmxCurve curve;
+
+    if (token == "scene") {
+      returnValue = (show.scenes.size() < 0xff);
+      show.scenes.emplace_back();
+    } else if (token == "curve") {
+      returnValue = (statement >> channel >> name) && (channel < 0xffff) && parseCurve(name, curve);
+
+      if (returnValue) {
+        show.curves.resize(std::max<size_t>(show.curves.size(), channel + 1), 0);
+        show.curves[channel] = curve;
+      }
+    } else {
+      std::istringstream record(line.substr(0, line.find('#')));
+
+      returnValue = (record >> channel >> value) && (channel <= 0xffff) && (value <= 0xff) &&
+                    !show.scenes.empty();
+
+      if (returnValue) {
+        show.scenes.back().push_back(Record{(uint16_t)channel, (uint8_t)value});
+      }
+    }
+
+    if (!returnValue) {
+      std::fprintf(stderr, "showc: invalid statement in line %u: %s\n", lineNumber, line.c_str());
+    }
+  }
+
+  return returnValue;
+}
+
+/**
+ * @brief Append a little-endian 16-bit field.
+ *
+ * @param[in,out] data the binary show file
+ * @param[in] value the field value
+ */
+void appendWord(std::vector<uint8_t>& data, const size_t value) {
+  data.push_back(value & 0xff);
+  data.push_back((value >> 8) & 0xff);
+}
+
+/**
+ * @brief Compile the show description into the binary show file format.
+ *
+ * @param[in] show the parsed show description
+ * @param[out] data the binary show file
+ * @return true - the show file got compiled
+ * @return false - the show file exceeds the maximum size
+ */
+bool compile(const Show& show, std::vector<uint8_t>& data) {
+  using namespace mididmxbridge::dmx;
+  const size_t curveTableSize = (show.curves.size() + 3) / 4;
+  size_t size = kShowHeaderSize + show.scenes.size() * kShowSceneEntrySize + curveTableSize;
+  size_t offset = size;
+
+  for (const auto& scene : show.scenes) {
+    size += scene.size() * kShowRecordSize;
+  }
+
+  if (size <= 0xffff) {
+    data.assign(kShowMagic, kShowMagic + sizeof(kShowMagic));
+    data.push_back(kShowVersion);
+    data.push_back(show.scenes.size());
+    appendWord(data, show.curves.size());
+    appendWord(data, size);
+    appendWord(data, 0);
+
+    for (const auto& scene : show.scenes) {
+      appendWord(data, offset);
+      appendWord(data, scene.size());
+      offset += scene.size() * kShowRecordSize;
+    }
+
+    data.resize(data.size() + curveTableSize, 0);
+    for (size_t channel = 0; channel < show.curves.size(); channel++) {
+      data[data.size() - curveTableSize + (channel >> 2)] |= show.curves[channel]
+                                                              << ((channel & 0x03) << 1);
+    }
+
+    for (const auto& scene : show.scenes) {
+      for (const auto& record : scene) {
+        appendWord(data, record.channel);
+        data.push_back(record.value);
+      }
+    }
+  } else {
+    std::fprintf(stderr, "showc: the show file exceeds 64 KiB\n");
+  }
+
+  return data.size() == size;
+}
+}  // namespace
+
+/**
+ * @brief Compile the text show description into a binary show file.
+ *
+ * @param[in] argc the number of arguments
+ * @param[in] argv the input and output file paths
+ * @return int - zero on success
+ */
+int main(int argc, char* argv[]) {
+  int returnValue = 1;
+  std::ifstream input;
+  std::vector<uint8_t> data;
+  Show show;
+
+  if (argc == 3) {
+    input.open(argv[1]);
+  } else {
+    std::fprintf(stderr, "usage: showc <show.txt> <show.mdxs>\n");
+  }
+
+  if (input && parse(input, show) && compile(show, data) &&
+      ShowFile(data.data(), data.size()).isValid()) {
+    std::ofstream output(argv[2], std::ios::binary);
+
+    if (output.write(reinterpret_cast<const char*>(data.data()), data.size())) {
+      std::printf("showc: %zu scenes, %zu curves, %zu bytes\n", show.scenes.size(),
+                  show.curves.size(), data.size());
+      returnValue = 0;
+    }
+  }
+
+  return returnValue;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file tracedump.cpp
+ * @author Christian Neukam
+ * @brief Host tool decoding a binary trace dump
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * Build and usage on a host system, from the repository root:
+ *
+ *   g++ -std=c++17 -Isrc -Isrc/midi_dmx extras/tracedump/tracedump.cpp -o tracedump
+ *   ./tracedump trace.bin
+ *
+ * The dump is written via mididmxbridge::util::traceDump(), e.g. to the serial interface of the
+ * Arduino board, and captured into a file. Without a file argument, the dump is read from stdin.
+ */
+#include <cstdio>
+
+#include "Trace.h"
+
+using namespace mididmxbridge::util;
+
+namespace {
+/**
+ * @brief Print a decoded trace record.
+ *
+ * @param[in] event the event id
+ * @param[in] timestamp the timestamp in ms
+ * @param[in] data0 the first payload byte
+ * @param[in] data1 the second payload byte
+ */
+void printRecord(const uint8_t event, const uint16_t timestamp, const uint8_t data0,
+                 const uint8_t data1) {
+  static const char* const kMidiEvents[] = {"cc",         "dump value", "dump end",
+                                            "nrpn value", "note on",    "note off"};
+
+  std::printf("%5u ms  ", timestamp);
+
+  if ((event >= kTraceMidi) && (event < kTraceMidi + 6)) {
+    std::printf("midi %-10s address=%u value=%u\n", kMidiEvents[event - kTraceMidi], data0, data1);
+  } else if (event == kTraceMidiResync) {
+    std::printf("midi resync  dropped=0x%02x\n", data0);
+  } else if ((event == kTraceDmxUpdate) || (event == kTraceDmxUpdateHigh)) {
+    std::printf("dmx update   channel=%u value=%u\n", ((event - kTraceDmxUpdate) << 8) | data0,
+                data1);
+  } else if (event == kTraceScene) {
+    std::printf("scene        %u -> %u\n", data0, data1);
+  } else if (event == kTraceGain) {
+    std::printf("gain         %u\n", (data0 << 8) | data1);
+  } else {
+    std::printf("unknown      event=0x%02x data=0x%02x 0x%02x\n", event, data0, data1);
+  }
+}
+}  // namespace
+
+/**
+ * @brief Decode the binary trace dump and print one line per record.
+ *
+ * @param[in] argc the number of arguments
+ * @param[in] argv the optional path of the trace dump
+ * @return int - zero on success
+ */
+int main(int argc, char* argv[]) {
+  int returnValue = 1;
+  std::FILE* file = (argc > 1) ? std::fopen(argv[1], "rb") : stdin;
+  uint8_t header[sizeof(kTraceMagic) + 3];
+
+  if (file && (std::fread(header, sizeof(header), 1, file) == 1)) {
+    bool isValid = (header[sizeof(kTraceMagic)] == kTraceVersion);
+
+    for (uint8_t idx = 0; idx < sizeof(kTraceMagic); idx++) {
+      isValid = isValid && (header[idx] == kTraceMagic[idx]);
+    }
+
+    if (isValid) {
+      const uint8_t* size = header + sizeof(kTraceMagic) + 1;
+      const uint16_t count = size[0] | (size[1] << 8);
+      uint8_t record[kTraceRecordSize];
+      uint16_t idx = 0;
+
+      for (; (idx < count) && (std::fread(record, sizeof(record), 1, file) == 1); idx++) {
+        printRecord(record[0], record[1] | (record[2] << 8), record[3], record[4]);
+      }
+
+      returnValue = (idx == count) ? 0 : 1;
+    }
+  }
+
+  if (returnValue) {
+    std::fprintf(stderr, "tracedump: invalid or truncated trace dump\n");
+  }
+
+  if (file && (file != stdin)) {
+    std::fclose(file);
+  }
+
+  return returnValue;
+}
@@ -48,9 +48,9 @@ using DmxOnChangeCallback = std::function<void(const uint8_t, const uint8_t)>;
  *
  */
 struct DmxRgb {
-  uint8_t red;   /**< the red color intensity in the range [0, 254] */
-  uint8_t green; /**< the green color intensity in the range [0, 254] */
-  uint8_t blue;  /**< the blue color intensity in the range [0, 254] */
+  uint8_t red;   /**< the red color intensity in the range [0, 255] */
+  uint8_t green; /**< the green color intensity in the range [0, 255] */
+  uint8_t blue;  /**< the blue color intensity in the range [0, 255] */
 };
 
 /**
@@ -0,0 +1,55 @@
+/**
+ * @file IDmxWriter.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::IDmxWriter interface
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_I_DMX_WRITER_H__
+#define __MIDIDMXBRIDGE_I_DMX_WRITER_H__
+
+#include <stdint.h>
+
+namespace mididmxbridge {
+
+/**
+ * @brief Interface of an object accepting DMX values for an asynchronous output.
+ *
+ * Implementations must return immediately, i.e. they only hand the DMX value off to the output
+ * stage, which performs the actual, potentially slow, write later on.
+ *
+ */
+class IDmxWriter {
+ public:
+  /**
+   * @brief Destroy the IDmxWriter object.
+   *
+   */
+  virtual ~IDmxWriter() = default;
+
+  /**
+   * @brief Submit the DMX value for output without blocking.
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] value the DMX value
+   * @return true - the DMX value got accepted
+   * @return false - the DMX value got dropped, e.g. as the output queue is full
+   */
+  virtual bool submit(const uint16_t channel, const uint8_t value) = 0;
+};
+}  // namespace mididmxbridge
+#endif
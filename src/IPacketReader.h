@@ -0,0 +1,85 @@
+/**
+ * @file IPacketReader.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::IPacketReader interface.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_I_PACKET_READER_H__
+#define __MIDIDMXBRIDGE_I_PACKET_READER_H__
+
+#include <stdint.h>
+
+#include "ISleep.h"
+
+namespace mididmxbridge {
+const uint8_t kUsbMidiPacketSize = 4; /**< the size of a USB-MIDI event packet in bytes */
+
+/**
+ * @brief Interface of an object reading USB-MIDI event packets.
+ *
+ * A USB-MIDI event packet consists of the header byte, i.e. the cable number in the upper and the
+ * Code Index Number (CIN) in the lower nibble, followed by three MIDI bytes. The packets are read
+ * in batches of aligned packets, so no resynchronization of the byte stream is required.
+ *
+ */
+class IPacketReader : public ISleep {
+ public:
+  /**
+   * @brief Destroy the IPacketReader object.
+   *
+   */
+  virtual ~IPacketReader() = default;
+
+  /**
+   * @brief Initialize the instance of the IPacketReader object.
+   *
+   */
+  virtual void begin() = 0;
+
+  /**
+   * @brief Read the available USB-MIDI event packets.
+   *
+   * @param[out] packets the buffer receiving the packets of ::kUsbMidiPacketSize bytes each
+   * @param[in] maxPackets the maximum number of packets fitting into the buffer \p packets
+   * @return uint8_t - the number of packets read
+   */
+  virtual uint8_t read(uint8_t* packets, const uint8_t maxPackets) = 0;
+
+  /**
+   * @brief Get the number of USB-MIDI event packets, which are received but not read yet.
+   *
+   * The count is used to detect a backlog of the input. The default implementation reports no
+   * packets. Implementations should override this function, e.g. with the fill level of the USB
+   * endpoint or host FIFO.
+   *
+   * @return uint16_t - the number of unread packets
+   */
+  virtual uint16_t available() { return 0; }
+
+  /**
+   * @brief Wait until packets are available or the timeout expires.
+   *
+   * The default implementation sleeps for the whole \p timeout_ms. Implementations should override
+   * this function to return as soon as packets arrive.
+   *
+   * @param[in] timeout_ms the maximum wait time in ms
+   */
+  virtual void wait(uint16_t timeout_ms) { sleep(timeout_ms); }
+};
+}  // namespace mididmxbridge
+#endif
@@ -57,6 +57,42 @@ class ISerialReader : public ISleep {
    * @return int - the value of the data
    */
   virtual int read() = 0;
+
+  /**
+   * @brief Read the available bytes from the serial input stack in one go.
+   *
+   * The function never blocks, i.e. it returns less than \p length bytes if less bytes are
+   * available. The default implementation reads byte by byte via available() and read().
+   * Implementations should override this function to copy the bytes with a single call.
+   *
+   * @param[out] buffer the buffer to fill
+   * @param[in] length the maximum number of bytes to read
+   * @return uint8_t - the number of bytes read
+   */
+  virtual uint8_t readBytes(uint8_t* buffer, const uint8_t length) {
+    uint8_t count = 0;
+
+    while ((count < length) && (available() > 0)) {
+      buffer[count++] = (uint8_t)read();
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief Wait until data is available on the serial interface or the timeout expires.
+   *
+   * The default implementation sleeps for the whole \p timeout_ms unless data is already available.
+   * Implementations should override this function to return as soon as data arrives, e.g. via an
+   * idle sleep woken by the receive interrupt or via `poll()` on host systems.
+   *
+   * @param[in] timeout_ms the maximum wait time in ms
+   */
+  virtual void wait(uint16_t timeout_ms) {
+    if (available() <= 0) {
+      sleep(timeout_ms);
+    }
+  }
 };
 }  // namespace mididmxbridge
 #endif
@@ -0,0 +1,80 @@
+/**
+ * @file ISnapshotStorage.h
+ * @author Christian Neukam
+ * @brief Definition of the ISnapshotStorage interface
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_I_SNAPSHOT_STORAGE_H__
+#define __MIDIDMXBRIDGE_I_SNAPSHOT_STORAGE_H__
+
+#include <stdint.h>
+
+namespace mididmxbridge {
+
+/**
+ * @brief Interface of a non-volatile memory holding the snapshot of the DMX state, e.g. EEPROM.
+ *
+ */
+class ISnapshotStorage {
+ public:
+  /**
+   * @brief Destroy the ISnapshotStorage object.
+   *
+   */
+  virtual ~ISnapshotStorage() = default;
+
+  /**
+   * @brief Get the size of the storage.
+   *
+   * @return uint16_t - the number of bytes available for the snapshot
+   */
+  virtual uint16_t size() const = 0;
+
+  /**
+   * @brief Read the byte at the address.
+   *
+   * @param[in] address the address in the range [0, size())
+   * @return uint8_t - the stored byte
+   */
+  virtual uint8_t read(const uint16_t address) = 0;
+
+  /**
+   * @brief Write the byte to the address.
+   *
+   * Implementations should skip the write if the byte is already stored, which saves write cycles
+   * of the memory.
+   *
+   * @param[in] address the address in the range [0, size())
+   * @param[in] value the byte to store
+   */
+  virtual void write(const uint16_t address, const uint8_t value) = 0;
+
+  /**
+   * @brief Check whether the storage accepts a read or a write without waiting, e.g. as no write
+   * of the memory is in progress.
+   *
+   * The periodic snapshot only accesses the storage once it is ready, see
+   * mididmxbridge::dmx::DmxSnapshot::update(). The default implementation is always ready.
+   *
+   * @return true - the storage is ready
+   * @return false - a write is in progress
+   */
+  virtual bool isReady() { return true; }
+};
+}  // namespace mididmxbridge
+#endif
@@ -23,22 +23,76 @@
 #define __MIDIDMXBRIDGE_H__
 
 #include "DmxTypes.h"
+#include "IDmxWriter.h"
+#include "IPacketReader.h"
 #include "ISerialReader.h"
+#include "ISnapshotStorage.h"
+#include "MidiDmxBridgeConfig.h"
 #include "SerialReaderDefault.h"
+#include "SerialReaderHardware.h"
+#include "SnapshotStorageEeprom.h"
+#include "midi_dmx/ArtNetPacket.h"
+#include "midi_dmx/CcCoalescer.h"
+#include "midi_dmx/ChannelGroupTable.h"
 #include "midi_dmx/Dmx.h"
+#include "midi_dmx/DmxFrame.h"
+#include "midi_dmx/DmxFrameBuffer.h"
+#include "midi_dmx/DmxMerge.h"
+#include "midi_dmx/DmxSink.h"
+#include "midi_dmx/DmxWriteQueue.h"
+#include "midi_dmx/Effects.h"
+#include "midi_dmx/GainKernel.h"
 #include "midi_dmx/MidiReader.h"
+#include "midi_dmx/NoteTrigger.h"
+#include "midi_dmx/Nrpn.h"
+#include "midi_dmx/RenderEngine.h"
+#include "midi_dmx/ResponseCurve.h"
+#include "midi_dmx/SacnPacket.h"
+#include "midi_dmx/ShowFile.h"
+#include "midi_dmx/UsbMidiReader.h"
 #include "midi_dmx/vector.h"
 
+using mididmxbridge::DefaultConfig;
 using mididmxbridge::DmxOnChangeCallback;
 using mididmxbridge::DmxRgb;
 using mididmxbridge::DmxRgbChannels;
+using mididmxbridge::IDmxWriter;
+using mididmxbridge::IPacketReader;
 using mididmxbridge::ISerialReader;
+using mididmxbridge::ISnapshotStorage;
+using mididmxbridge::dmx::BasicDmx;
+using mididmxbridge::dmx::CallbackSink;
+using mididmxbridge::dmx::ChannelSink;
 using mididmxbridge::dmx::Dmx;
+using mididmxbridge::dmx::DmxCurve;
+using mididmxbridge::dmx::DmxEffect;
+using mididmxbridge::dmx::DmxFrame;
+using mididmxbridge::dmx::DmxFrameBuffer;
+using mididmxbridge::dmx::DmxMerge;
+using mididmxbridge::dmx::DmxMergeMode;
+using mididmxbridge::dmx::DmxWaveform;
+using mididmxbridge::dmx::DmxWriteQueue;
+using mididmxbridge::dmx::kCurveGamma;
+using mididmxbridge::dmx::kCurveLinear;
+using mididmxbridge::dmx::kCurveSCurve;
+using mididmxbridge::dmx::kCurveSquare;
+using mididmxbridge::dmx::kMergeHtp;
+using mididmxbridge::dmx::kMergeLtp;
+using mididmxbridge::dmx::kNoController;
+using mididmxbridge::dmx::kWaveformChase;
+using mididmxbridge::dmx::kWaveformSine;
+using mididmxbridge::dmx::kWaveformSquare;
+using mididmxbridge::dmx::kWaveformTriangle;
+using mididmxbridge::dmx::scaleUniverse;
+using mididmxbridge::dmx::ShowFile;
+using mididmxbridge::dmx::WriterSink;
 using mididmxbridge::midi::MidiReader;
-
-namespace mididmxbridge {
-class ISleep; /**< forward declaration */
-}
+using mididmxbridge::midi::UsbMidiReader;
+#ifndef ARDUINO
+using mididmxbridge::dmx::ArtNetPacket;
+using mididmxbridge::dmx::RenderEngine;
+using mididmxbridge::dmx::SacnPacket;
+#endif
 
 /**
  * @brief This class defines the API of the MidiDmxBridge library.
@@ -47,39 +101,86 @@ class ISleep; /**< forward declaration */
  * control signals. The MIDI data is provided via a serial interface, which is abstracted via
  * mididmxbridge::ISerialReader and must be implemented by the application.
  *
+ * Alternatively, the MIDI data can be provided as USB-MIDI event packets abstracted via
+ * mididmxbridge::IPacketReader by using mididmxbridge::midi::UsbMidiReader as \p Reader.
+ *
  * As soon as valid MIDI CC signals are received via a specific MIDI channel, a
  * mididmxbridge::dmx::DmxOnChangeCallback callback is triggered, which contains the current DMX
  * control signals. One callback is triggered for each MIDI CC signal received.
  *
+ * A complete look can be loaded via a MIDI System Exclusive (SysEx) channel dump, see
+ * mididmxbridge::midi::MidiReader. The DMX values of a dump are applied as one batch, i.e. the
+ * callbacks are triggered after the whole dump is received.
+ *
+ * If more than \p Config::kCoalesceThreshold bytes are pending on the input, the queued MIDI CC
+ * messages are coalesced, i.e. only the newest value per controller is applied, see
+ * mididmxbridge::midi::CcCoalescer. The coalesced values are applied before the next other
+ * message, so the order of the writes is kept.
+ *
+ * With the NRPN support enabled via \p Config::kNrpn, all DMX channels can be addressed via
+ * Non-Registered Parameter Numbers, see mididmxbridge::midi::NrpnDecoder.
+ *
  * In order to adapt the brightness of the connected lighting to the local conditions, a gain can be
  * set to adjust the brightness. The signal can only be attenuated.
  *
+ * Instead of the callback, any DMX output sink type \p Sink can be used, which is called via
+ * `sink(channel, value)`. As the sink is a compile-time type, the complete path from the MIDI input
+ * to the DMX output can be inlined by the compiler, see mididmxbridge::dmx::BasicDmx.
+ *
+ * The capacities and features of the bridge are defined at compile-time via \p Config, see
+ * mididmxbridge::DefaultConfig.
+ *
+ * @tparam Sink the type of the DMX output sink
+ * @tparam Config the compile-time configuration
+ * @tparam Reader the type of the MIDI reader, i.e. mididmxbridge::midi::MidiReader or
+ *                mididmxbridge::midi::UsbMidiReader
  */
-class MidiDmxBridge {
+template <class Sink, class Config = DefaultConfig, class Reader = MidiReader>
+class BasicMidiDmxBridge {
+  static_assert(Config::kInputBufferSize >= Reader::kMinBufferSize, "input buffer too small");
+  static_assert(Config::kUniverseSize <= mididmxbridge::kDmxUniverseSize, "invalid universe size");
+
  public:
   /**
-   * @brief Construct a new MidiDmxBridge object.
+   * @brief Construct a new BasicMidiDmxBridge object.
    *
    * @param[in] channel the MIDI channel to listen to in the range [1, 16]
-   * @param[in] callback the callback to trigger once the DMX values change
-   * @param[in] serial the serial interface
+   * @param[in] sink the output sink to trigger once the DMX values change
+   * @param[in] input the input interface of the \p Reader, e.g. the serial interface
    */
-  MidiDmxBridge(const uint8_t channel, DmxOnChangeCallback callback, ISerialReader& serial);
+  BasicMidiDmxBridge(const uint8_t channel, Sink sink, typename Reader::Input& input)
+      : mDmx(sink),
+        mReader(channel, input, mInputBuffer, Config::kInputBufferSize,
+                Config::kSysExManufacturerId, Config::kSysExDeviceId) {}
 
   /**
-   * @brief Destroy the MidiDmxBridge object.
+   * @brief Destroy the BasicMidiDmxBridge object.
    *
    */
-  virtual ~MidiDmxBridge() = default;
+  virtual ~BasicMidiDmxBridge() = default;
 
   /**
-   * @brief Initialize the MidiDmxBridge object.
+   * @brief Initialize the BasicMidiDmxBridge object.
    *
    * This function should be called before all other API functions in the Arduino sketch in setup().
    *
    */
   void begin();
 
+  /**
+   * @brief Initialize the BasicMidiDmxBridge object and restore the last snapshot.
+   *
+   * Requires the snapshots to be enabled via \p Config::kSnapshot. The dynamic scene and the gain
+   * are restored from the \p storage and sent via the output sink immediately, so the lighting is
+   * back right after a power loss. Afterwards, the changes are stored every
+   * \p Config::kSnapshotInterval ms within listen(), see saveSnapshot().
+   *
+   * This function should be called instead of begin() in the Arduino sketch in setup().
+   *
+   * @param[in] storage the snapshot storage, e.g. SnapshotStorageEeprom
+   */
+  void begin(ISnapshotStorage& storage);
+
   /**
    * @brief Setup the static scene.
    *
@@ -90,6 +191,17 @@ class MidiDmxBridge {
    */
   void setStaticScene(const DmxRgbChannels& channels, const DmxRgb& rgb);
 
+  /**
+   * @brief Setup one of the static scenes configured via \p Config::kStaticScenes.
+   *
+   * This function should be used in the Arduino sketch in setup() after begin().
+   *
+   * @param[in] scene the index of the static scene in the range [0, Config::kStaticScenes)
+   * @param[in] channels the DMX channels associated with RGB
+   * @param[in] rgb the RGB value to set
+   */
+  void setStaticScene(const uint8_t scene, const DmxRgbChannels& channels, const DmxRgb& rgb);
+
   /**
    * @brief Sets the attenuation of the generated DMX signal.
    *
@@ -119,11 +231,130 @@ class MidiDmxBridge {
    *
    * This function can always be called after begin().
    *
+   * @param[in] scene the index of the static scene in the range [0, Config::kStaticScenes)
+   */
+  void switchToStaticScene(const uint8_t scene = 0);
+
+  /**
+   * @brief Start an effect in one of the effect slots configured via \p Config::kEffects.
+   *
+   * The effect is evaluated once per listen() call and written into the dynamic scene. MIDI CC
+   * signals assigned to the rate or depth of the effect control the effect instead of a DMX
+   * channel.
+   *
+   * This function can always be called after begin().
+   *
+   * @param[in] slot the effect slot in the range [0, Config::kEffects)
+   * @param[in] effect the effect to run
+   */
+  void setEffect(const uint8_t slot, const DmxEffect& effect);
+
+  /**
+   * @brief Stop the effect in one of the effect slots.
+   *
+   * This function can always be called after begin().
+   *
+   * @param[in] slot the effect slot in the range [0, Config::kEffects)
+   */
+  void clearEffect(const uint8_t slot);
+
+  /**
+   * @brief Assign a group of DMX channels to a MIDI note for flash and bump effects.
+   *
+   * Requires the note triggers to be enabled via \p Config::kNoteTriggers. A MIDI Note On flashes
+   * the DMX channels at the level given by the note velocity, the MIDI Note Off releases them. The
+   * flash is sent within the listen() call receiving the note, bypassing the MIDI CC processing
+   * and the effects.
+   *
+   * This function can always be called after begin().
+   *
+   * @param[in] note the MIDI note in the range [0, 127]
+   * @param[in] channels the DMX channels below \p Config::kUniverseSize, at most
+   * \p Config::kNoteGroupSize
+   * @return true - the note trigger got assigned
+   * @return false - the note or a channel is invalid, all note triggers are in use or they are
+   * disabled
+   */
+  bool setNoteTrigger(const uint8_t note, const mididmxbridge::vector<uint16_t>& channels);
+
+  /**
+   * @brief Assign a group of DMX channels to a MIDI CC controller.
+   *
+   * Requires the channel groups to be enabled via \p Config::kCcGroups. A MIDI CC value received on
+   * the \p controller updates all DMX channels of the group in one pass instead of the DMX channel
+   * of the controller, e.g. one fader dims the red channel of all RGB pars. Each DMX channel maps
+   * the MIDI CC value via its own response curve. Effects assigned to the \p controller take
+   * precedence.
+   *
+   * This function can always be called after begin().
+   *
+   * @param[in] controller the MIDI CC controller in the range [0, 127]
+   * @param[in] channels the DMX channels below \p Config::kUniverseSize, at most
+   * \p Config::kCcGroupSize
+   * @return true - the channel group got assigned
+   * @return false - the controller or a channel is invalid, all channel groups are in use or they
+   * are disabled
+   */
+  bool setCcGroup(const uint8_t controller, const mididmxbridge::vector<uint16_t>& channels);
+
+  /**
+   * @brief Set the response curve mapping MIDI CC values onto the DMX channel.
+   *
+   * Requires the per-channel response curves to be enabled via \p Config::kResponseCurves,
+   * otherwise all channels use the linear response curve.
+   *
+   * This function can always be called after begin().
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] curve the response curve to apply, e.g. ::kCurveGamma for LED dimmers
+   */
+  void setResponseCurve(const uint16_t channel, const DmxCurve curve);
+
+  /**
+   * @brief Send the complete DMX state via the output sink again.
+   *
+   * Use this function to recover an output stage which lost its state, e.g. after a reconnect.
+   * The values are sent as long as the sink accepts them, the remaining values follow via listen().
+   * DMX values dropped by the sink, e.g. by a full mididmxbridge::dmx::DmxWriteQueue, are sent
+   * again via listen() anyway.
+   *
+   * This function can always be called after begin().
+   *
+   */
+  void refresh();
+
+  /**
+   * @brief Load a precompiled binary show file replacing the static scenes and response curves.
+   *
+   * Requires the show files to be enabled via \p Config::kShowFile. The show file is accessed in
+   * place, e.g. memory-mapped via ShowFileMapped on host systems or located in the program memory
+   * of AVR boards, see mididmxbridge::dmx::ShowFile.
+   *
+   * This function can always be called after begin().
+   *
+   * @param[in] show the show file, whose data must stay valid while it is loaded
+   * @return true - the show file got loaded
+   * @return false - the show file is invalid or show files are disabled
    */
-  void switchToStaticScene();
+  bool loadShow(const ShowFile& show);
 
   /**
-   * @brief Listen on the serial interface for the next MIDI CC value and update the DMX state.
+   * @brief Store all changes of the dynamic scene and the gain in the snapshot storage at once.
+   *
+   * Requires a snapshot storage passed via begin(). The periodic snapshot within listen() spreads
+   * the writes across several calls, whereas this function blocks until all changes are stored,
+   * e.g. to save a look on request.
+   *
+   * This function can always be called after begin().
+   *
+   */
+  void saveSnapshot();
+
+  /**
+   * @brief Listen on the input interface for the next MIDI CC value and update the DMX state.
+   *
+   * Afterwards, the function blocks until new input arrives, but at most
+   * \p Config::kListenSleepTime ms, see mididmxbridge::ISerialReader::wait().
    *
    * This function should be used in the Arduino sketch in loop().
    *
@@ -131,8 +362,191 @@ class MidiDmxBridge {
   void listen();
 
  private:
-  mididmxbridge::ISleep& mSleep; /**< the sleep handler object */
-  Dmx mDmx;                      /**< the DMX handler object */
-  MidiReader mReader;            /**< the MIDI reader object */
+  using Coalescer = mididmxbridge::midi::CcCoalescer<(Config::kCoalesceThreshold > 0)>;
+  using NoteTriggers = mididmxbridge::midi::NoteTriggers<Config::kNoteTriggers,
+                                                         Config::kNoteGroupSize,
+                                                         Config::kUniverseSize>;
+  using CcGroups = mididmxbridge::midi::ChannelGroupTable<Config::kCcGroups, Config::kCcGroupSize,
+                                                          Config::kUniverseSize>;
+
+  /**
+   * @brief Apply the decoded MIDI message to the DMX state.
+   *
+   * @param[in] message the decoded MIDI message
+   */
+  void process(const mididmxbridge::midi::MidiMessage& message);
+
+  BasicDmx<Sink, Config> mDmx;                                  /**< the DMX handler object */
+  uint8_t mInputBuffer[Config::kInputBufferSize];               /**< the MIDI input buffer */
+  Reader mReader;                                               /**< the MIDI reader object */
+  mididmxbridge::dmx::EffectsEngine<Config::kEffects> mEffects; /**< the effects engine */
+  mididmxbridge::midi::NrpnDecoder<Config::kNrpn> mNrpn;        /**< the NRPN decoder */
+  Coalescer mCoalescer;                                         /**< the MIDI CC coalescer */
+  NoteTriggers mNoteTriggers;                                   /**< the MIDI note triggers */
+  CcGroups mCcGroups;                                           /**< the MIDI CC channel groups */
 };
+
+/**
+ * @brief The MidiDmxBridge using the mididmxbridge::DmxOnChangeCallback callback API.
+ *
+ */
+using MidiDmxBridge = BasicMidiDmxBridge<CallbackSink>;
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::begin() { mReader.begin(); }
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::begin(ISnapshotStorage& storage) {
+  mReader.begin();
+  mDmx.restoreSnapshot(storage);
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::setStaticScene(const DmxRgbChannels& channels,
+                                                              const DmxRgb& rgb) {
+  mDmx.setStaticScene(channels, rgb);
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::setStaticScene(const uint8_t scene,
+                                                              const DmxRgbChannels& channels,
+                                                              const DmxRgb& rgb) {
+  mDmx.setStaticScene(scene, channels, rgb);
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::setAttenuation(const uint16_t attenuation) {
+  mDmx.setGain(attenuation);
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::switchToDynamicScene() {
+  mDmx.activateDynamicScene();
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::switchToStaticScene(const uint8_t scene) {
+  mDmx.activateStaticScene(scene);
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::setEffect(const uint8_t slot,
+                                                         const DmxEffect& effect) {
+  mEffects.setEffect(slot, effect);
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::clearEffect(const uint8_t slot) {
+  mEffects.clearEffect(slot);
+}
+
+template <class Sink, class Config, class Reader>
+bool BasicMidiDmxBridge<Sink, Config, Reader>::setNoteTrigger(
+    const uint8_t note, const mididmxbridge::vector<uint16_t>& channels) {
+  return mNoteTriggers.set(note, channels);
+}
+
+template <class Sink, class Config, class Reader>
+bool BasicMidiDmxBridge<Sink, Config, Reader>::setCcGroup(
+    const uint8_t controller, const mididmxbridge::vector<uint16_t>& channels) {
+  return mCcGroups.set(controller, channels);
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::setResponseCurve(const uint16_t channel,
+                                                                const DmxCurve curve) {
+  mDmx.setResponseCurve(channel, curve);
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::refresh() {
+  mDmx.refresh();
+}
+
+template <class Sink, class Config, class Reader>
+bool BasicMidiDmxBridge<Sink, Config, Reader>::loadShow(const ShowFile& show) {
+  return mDmx.loadShow(show);
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::saveSnapshot() {
+  mDmx.saveSnapshot();
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::process(
+    const mididmxbridge::midi::MidiMessage& message) {
+  switch (message.event) {
+    case mididmxbridge::midi::kMidiCc: {
+      const auto updateChannel = [this, &message](const uint16_t channel) {
+        mDmx.setMidiCcChannel(channel, message.value);
+      };
+
+      if (!mEffects.setMidiCcValue(message.address, message.value) &&
+          !mCcGroups.forEach(message.address, updateChannel)) {
+        mDmx.setMidiCcValue(message.address, message.value);
+      }
+      break;
+    }
+    case mididmxbridge::midi::kMidiNrpnValue:
+      mDmx.setDmxValue(mididmxbridge::dmx::DmxValue{message.address, message.value});
+      break;
+    case mididmxbridge::midi::kMidiDumpValue:
+      mDmx.stageDmxValue(mididmxbridge::dmx::DmxValue{message.address, message.value});
+      break;
+    case mididmxbridge::midi::kMidiNoteOn:
+    case mididmxbridge::midi::kMidiNoteOff:
+      mNoteTriggers.trigger(message, [this](const uint16_t channel, const uint8_t level) {
+        mDmx.flash(channel, level);
+      });
+      break;
+    default:
+      mDmx.commit();
+      break;
+  }
+}
+
+template <class Sink, class Config, class Reader>
+void BasicMidiDmxBridge<Sink, Config, Reader>::listen() {
+  mididmxbridge::midi::MidiMessage message;
+
+  if (Config::kCoalesceThreshold && (mReader.pending() > Config::kCoalesceThreshold)) {
+    const auto processCc = [this](const mididmxbridge::midi::MidiMessage& cc) { process(cc); };
+
+    // catch up with the backlog by applying the newest value per MIDI CC controller only; the
+    // collected values are applied before any other message to keep the order of the writes
+    while (mReader.read(message)) {
+      if (mNrpn.decode(message) && !mCoalescer.add(message)) {
+        mCoalescer.flush(processCc);
+        process(message);
+      }
+    }
+
+    mCoalescer.flush(processCc);
+  } else {
+    bool isPending = true;
+
+    // a SysEx channel dump is processed as a whole, a single MIDI CC value per call otherwise; with
+    // note triggers, all received messages are processed so no note waits behind MIDI CC values
+    while (isPending && mReader.read(message)) {
+      const bool isToProcess = mNrpn.decode(message);
+
+      if (isToProcess) {
+        process(message);
+      }
+
+      isPending = !isToProcess || (message.event == mididmxbridge::midi::kMidiDumpValue) ||
+                  (Config::kNoteTriggers > 0);
+    }
+  }
+
+  mEffects.update([this](const uint16_t channel, const uint8_t effectValue) {
+    mDmx.setDmxValue(mididmxbridge::dmx::DmxValue{channel, effectValue});
+  });
+
+  mDmx.resend();
+  mDmx.updateSnapshot();
+
+  mReader.wait(Config::kListenSleepTime);  // block until new input arrives or the timeout expires
+}
 #endif
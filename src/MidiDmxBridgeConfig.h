@@ -0,0 +1,70 @@
+/**
+ * @file MidiDmxBridgeConfig.h
+ * @author Christian Neukam
+ * @brief Definition of the compile-time configuration of the MidiDmxBridge library.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_CONFIG_H__
+#define __MIDIDMXBRIDGE_CONFIG_H__
+
+#include <stdint.h>
+
+#include "midi_dmx/constants.h"
+
+namespace mididmxbridge {
+/**
+ * @brief This struct defines the default compile-time configuration of the MidiDmxBridge library.
+ *
+ * The configuration is passed as template parameter to BasicMidiDmxBridge and
+ * mididmxbridge::dmx::BasicDmx. All capacities are allocated statically, so the RAM usage can be
+ * tuned per board. A feature which is disabled via the configuration costs neither flash nor RAM.
+ *
+ * A custom configuration can be derived from this struct overriding single values only, e.g.:
+ *
+ * ```cpp
+ * struct UnoConfig : mididmxbridge::DefaultConfig {
+ *   static const uint16_t kUniverseSize = 32;
+ *   static const uint8_t kStaticScenes = 0;
+ * };
+ * ```
+ *
+ */
+struct DefaultConfig {
+  static const uint16_t kUniverseSize = kMaxMidiValue + 1; /**< number of DMX channels */
+  static const uint8_t kStaticScenes = 1;                  /**< static scenes, 0 disables them */
+  static const uint8_t kStaticSceneSize = 128;             /**< maximum values per static scene */
+  static const uint8_t kInputBufferSize = 32;              /**< MIDI input buffer size in bytes */
+  static const uint16_t kListenSleepTime = 3;              /**< max. wait time of listen() in ms */
+  static const uint16_t kCoalesceThreshold = 0;            /**< backlog in bytes, 0 disables it */
+  static const uint8_t kEffects = 0;                       /**< effect slots, 0 disables them */
+  static const bool kResponseCurves = false;               /**< per-channel response curves */
+  static const bool kNrpn = false;                         /**< NRPN addressing of DMX channels */
+  static const bool kShowFile = false;                     /**< loading of binary show files */
+  static const uint8_t kNoteTriggers = 0;                  /**< note triggers, 0 disables them */
+  static const uint8_t kNoteGroupSize = 8;                 /**< maximum channels per note trigger */
+  static const bool kSnapshot = false;                     /**< snapshots of the dynamic scene */
+  static const uint16_t kSnapshotInterval = 10000;         /**< snapshot period in ms, 0: manual */
+  static const bool kChannelIndex = false;                 /**< sorted index of the set channels */
+  static const uint8_t kCcGroups = 0;                      /**< CC groups, 0 disables them */
+  static const uint8_t kCcGroupSize = 24;                  /**< maximum channels per CC group */
+
+  static const uint8_t kSysExManufacturerId = kSysExNonCommercialId; /**< SysEx manufacturer ID */
+  static const uint8_t kSysExDeviceId = kSysExAllDevices;            /**< SysEx device ID */
+};
+}  // namespace mididmxbridge
+#endif
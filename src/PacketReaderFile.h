@@ -0,0 +1,110 @@
+/**
+ * @file PacketReaderFile.h
+ * @author Christian Neukam
+ * @brief Definition of the PacketReaderFile class.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_PACKET_READER_FILE_H__
+#define __MIDIDMXBRIDGE_PACKET_READER_FILE_H__
+
+#ifndef ARDUINO
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "IPacketReader.h"
+
+/**
+ * @brief Host implementation of the mididmxbridge::IPacketReader interface reading a file.
+ *
+ * The file contains a stream of USB-MIDI event packets of mididmxbridge::kUsbMidiPacketSize bytes
+ * each, e.g. captured from a USB-MIDI controller. This way, the USB-MIDI input path can be tested
+ * on the host with recorded packet streams. An incomplete packet at the end of the file is ignored.
+ *
+ */
+class PacketReaderFile : public mididmxbridge::IPacketReader {
+ public:
+  /**
+   * @brief Construct a new PacketReaderFile object.
+   *
+   * @param[in] path the path of the packet file, which must outlive the PacketReaderFile object
+   */
+  explicit PacketReaderFile(const char* path) : mPath(path), mFile(nullptr), mSize(0) {}
+
+  /**
+   * @brief Destroy the PacketReaderFile object and close the file.
+   *
+   */
+  ~PacketReaderFile() {
+    if (mFile) {
+      std::fclose(mFile);
+    }
+  }
+
+  PacketReaderFile(const PacketReaderFile&) = delete;
+  PacketReaderFile& operator=(const PacketReaderFile&) = delete;
+
+  void begin() override {
+    if (!mFile) {
+      mFile = std::fopen(mPath, "rb");
+    }
+
+    if (mFile && (std::fseek(mFile, 0, SEEK_END) == 0)) {
+      mSize = std::ftell(mFile);
+      std::rewind(mFile);
+    }
+  }
+
+  uint8_t read(uint8_t* packets, const uint8_t maxPackets) override {
+    uint8_t returnValue = 0;
+
+    if (mFile) {
+      const size_t packetSize = mididmxbridge::kUsbMidiPacketSize;
+      returnValue = (uint8_t)std::fread(packets, packetSize, maxPackets, mFile);
+    }
+
+    return returnValue;
+  }
+
+  uint16_t available() override {
+    const long packetSize = mididmxbridge::kUsbMidiPacketSize;
+    const long remaining = mFile ? (mSize - std::ftell(mFile)) : 0;
+    const long packets = (remaining > 0) ? (remaining / packetSize) : 0;
+
+    return (packets < 0xffff) ? (uint16_t)packets : 0xffff;
+  }
+
+  void sleep(uint16_t sleep_ms) override {
+    std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
+  }
+
+  /**
+   * @brief Check if the packet file is opened.
+   *
+   * @return true - the file got opened via begin()
+   * @return false - otherwise
+   */
+  bool isOpen() const { return mFile != nullptr; }
+
+ private:
+  const char* mPath; /**< the path of the packet file */
+  std::FILE* mFile;  /**< the packet file */
+  long mSize;        /**< the size of the packet file in bytes */
+};
+#endif
+#endif
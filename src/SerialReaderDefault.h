@@ -26,6 +26,10 @@
 #include <Arduino.h>
 #include <SoftwareSerial.h>
 
+#ifdef __AVR__
+#include <avr/sleep.h>
+#endif
+
 #include "ISerialReader.h"
 
 #if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__) || defined(__AVR_ATmega32U4__)
@@ -101,6 +105,18 @@ class SerialReaderDefault : public mididmxbridge::ISerialReader {
 
   void sleep(uint16_t sleep_ms) override { delay(sleep_ms); }
 
+  void wait(uint16_t timeout_ms) override {
+    const unsigned long start = millis();
+
+    while ((mSoftSerial.available() <= 0) && ((millis() - start) < timeout_ms)) {
+#ifdef __AVR__
+      // the idle sleep is woken by the RX pin-change interrupt or the timer tick at the latest
+      set_sleep_mode(SLEEP_MODE_IDLE);
+      sleep_mode();
+#endif
+    }
+  }
+
  private:
   const uint8_t mRxPin;       /**< the receiving input pin */
   const uint8_t mTxPin;       /**< the transmission output pin */
@@ -0,0 +1,186 @@
+/**
+ * @file SerialReaderFd.h
+ * @author Christian Neukam
+ * @brief Definition of the SerialReaderFd class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_SERIAL_READER_FD_H__
+#define __MIDIDMXBRIDGE_SERIAL_READER_FD_H__
+
+#ifndef ARDUINO
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+
+#include "ISerialReader.h"
+#include "midi_dmx/PollWait.h"
+
+/**
+ * @brief Host implementation of the mididmxbridge::ISerialReader interface reading a file
+ * descriptor.
+ *
+ * The file descriptor is operated non-blocking, and the input is fetched with large `read()` calls
+ * into an internal buffer, i.e. one system call serves many MIDI bytes. Waiting for input is based
+ * on `poll()`, see mididmxbridge::util::waitReadable(). Supported inputs are:
+ *
+ *  - raw MIDI devices, e.g. `/dev/snd/midiC1D0`
+ *  - named pipes (FIFOs), which are opened read-write so the reader never sees an end of file when
+ *    the writer reconnects
+ *  - terminals and pseudo-terminals, which are switched into raw mode
+ *
+ * Named pipes and pseudo-terminals allow to test the MIDI input path without MIDI hardware.
+ *
+ */
+class SerialReaderFd : public mididmxbridge::ISerialReader {
+ public:
+  /**
+   * @brief Construct a new SerialReaderFd object opening the path on begin().
+   *
+   * @param[in] path the path of the input, which must outlive the SerialReaderFd object
+   */
+  explicit SerialReaderFd(const char* path)
+      : mPath(path), mFd(-1), mIsOwner(true), mIsClosed(false), mHead(0), mCount(0) {}
+
+  /**
+   * @brief Construct a new SerialReaderFd object reading an already opened file descriptor.
+   *
+   * The file descriptor is switched to non-blocking mode on begin(), but it is not closed by the
+   * SerialReaderFd object, e.g. the master side of a pseudo-terminal.
+   *
+   * @param[in] fd the opened file descriptor
+   */
+  explicit SerialReaderFd(const int fd)
+      : mPath(nullptr), mFd(fd), mIsOwner(false), mIsClosed(false), mHead(0), mCount(0) {}
+
+  /**
+   * @brief Destroy the SerialReaderFd object and close the file descriptor if it got opened by it.
+   *
+   */
+  ~SerialReaderFd() {
+    if (mIsOwner && (mFd >= 0)) {
+      close(mFd);
+    }
+  }
+
+  SerialReaderFd(const SerialReaderFd&) = delete;
+  SerialReaderFd& operator=(const SerialReaderFd&) = delete;
+
+  void begin() override {
+    if (mPath && (mFd < 0)) {
+      struct stat info;
+      const bool isFifo = (stat(mPath, &info) == 0) && S_ISFIFO(info.st_mode);
+
+      mFd = open(mPath, (isFifo ? O_RDWR : O_RDONLY) | O_NONBLOCK | O_NOCTTY);
+    }
+
+    if (mFd >= 0) {
+      struct termios tio;
+
+      fcntl(mFd, F_SETFL, fcntl(mFd, F_GETFL) | O_NONBLOCK);
+
+      if (isatty(mFd) && (tcgetattr(mFd, &tio) == 0)) {
+        cfmakeraw(&tio);
+        tcsetattr(mFd, TCSANOW, &tio);
+      }
+    }
+  }
+
+  int available() override {
+    fill();
+    return mCount - mHead;
+  }
+
+  int read() override {
+    fill();
+    return (mHead < mCount) ? mBuffer[mHead++] : -1;
+  }
+
+  uint8_t readBytes(uint8_t* buffer, const uint8_t length) override {
+    uint8_t count = 0;
+
+    fill();
+    while ((count < length) && (mHead < mCount)) {
+      buffer[count++] = mBuffer[mHead++];
+    }
+
+    return count;
+  }
+
+  void sleep(uint16_t sleep_ms) override {
+    std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
+  }
+
+  void wait(uint16_t timeout_ms) override {
+    if (available() <= 0) {
+      // a closed input is readable forever, so sleep instead of spinning on poll()
+      if (mIsClosed || !isOpen()) {
+        sleep(timeout_ms);
+      } else {
+        mididmxbridge::util::waitReadable(mFd, timeout_ms);
+      }
+    }
+  }
+
+  /**
+   * @brief Check if the file descriptor is opened.
+   *
+   * @return true - the file descriptor is valid
+   * @return false - otherwise
+   */
+  bool isOpen() const { return mFd >= 0; }
+
+  /**
+   * @brief Check if the input got closed, e.g. the writer of a pseudo-terminal hung up.
+   *
+   * @return true - the input reported the end of file or an error
+   * @return false - otherwise
+   */
+  bool isClosed() const { return mIsClosed; }
+
+ private:
+  static const uint16_t kBufferSize = 256; /**< the size of the internal buffer in bytes */
+
+  /**
+   * @brief Refill the internal buffer with a single `read()` call once it is consumed.
+   *
+   */
+  void fill() {
+    if ((mHead >= mCount) && isOpen() && !mIsClosed) {
+      const ssize_t received = ::read(mFd, mBuffer, kBufferSize);
+
+      mHead = 0;
+      mCount = (received > 0) ? (uint16_t)received : 0;
+      mIsClosed = (received == 0) || ((received < 0) && (errno != EAGAIN) && (errno != EINTR));
+    }
+  }
+
+  const char* mPath;            /**< the path of the input, nullptr for an opened descriptor */
+  int mFd;                      /**< the file descriptor */
+  bool mIsOwner;                /**< true if the file descriptor is closed on destruction */
+  bool mIsClosed;               /**< true once the input reported the end of file or an error */
+  uint16_t mHead;               /**< the index of the next byte in the internal buffer */
+  uint16_t mCount;              /**< the number of bytes in the internal buffer */
+  uint8_t mBuffer[kBufferSize]; /**< the internal buffer */
+};
+#endif
+#endif
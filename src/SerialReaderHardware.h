@@ -0,0 +1,100 @@
+/**
+ * @file SerialReaderHardware.h
+ * @author Christian Neukam
+ * @brief Definition of the SerialReaderHardware class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_SERIAL_READER_HARDWARE_H__
+#define __MIDIDMXBRIDGE_SERIAL_READER_HARDWARE_H__
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+#ifdef __AVR__
+#include <avr/sleep.h>
+#endif
+
+#include "ISerialReader.h"
+
+/**
+ * @brief Implementation of the mididmxbridge::ISerialReader interface using a hardware UART.
+ *
+ * Unlike SerialReaderDefault, the MIDI bytes are received by the UART and buffered by its receive
+ * interrupt, i.e. no CPU time is spent on sampling the RX pin and interrupts stay enabled, which
+ * keeps the timing of a concurrent DMX output intact. Boards with several UARTs, e.g. the Mega
+ * (Serial1 - Serial3) or the Leonardo (Serial1), receive MIDI on one port and send DMX on another.
+ *
+ * The received bytes are transferred into the input buffer of the MIDI reader via readBytes() in
+ * one go, i.e. with a single virtual call per batch.
+ *
+ */
+class SerialReaderHardware : public mididmxbridge::ISerialReader {
+ public:
+  /**
+   * @brief Construct a new SerialReaderHardware object.
+   *
+   * @param[in] serial the hardware serial port receiving MIDI, e.g. Serial1
+   */
+  explicit SerialReaderHardware(HardwareSerial& serial) : mSerial(serial) {}
+
+  /**
+   * @brief Destroy the SerialReaderHardware object
+   *
+   */
+  ~SerialReaderHardware() = default;
+
+  void begin() override { mSerial.begin(31250); }
+
+  int available() override { return mSerial.available(); }
+
+  int read() override { return mSerial.read(); }
+
+  uint8_t readBytes(uint8_t* buffer, const uint8_t length) override {
+    const int available = mSerial.available();
+    uint8_t count = length;
+
+    if (available < length) {
+      count = (available > 0) ? (uint8_t)available : 0;
+    }
+
+    for (uint8_t idx = 0; idx < count; idx++) {
+      buffer[idx] = (uint8_t)mSerial.read();
+    }
+
+    return count;
+  }
+
+  void sleep(uint16_t sleep_ms) override { delay(sleep_ms); }
+
+  void wait(uint16_t timeout_ms) override {
+    const unsigned long start = millis();
+
+    while ((mSerial.available() <= 0) && ((millis() - start) < timeout_ms)) {
+#ifdef __AVR__
+      // the idle sleep is woken by the UART receive interrupt or the timer tick at the latest
+      set_sleep_mode(SLEEP_MODE_IDLE);
+      sleep_mode();
+#endif
+    }
+  }
+
+ private:
+  HardwareSerial& mSerial; /**< the hardware serial port */
+};
+#endif
+#endif
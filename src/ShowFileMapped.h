@@ -0,0 +1,109 @@
+/**
+ * @file ShowFileMapped.h
+ * @author Christian Neukam
+ * @brief Definition of the ShowFileMapped class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_SHOW_FILE_MAPPED_H__
+#define __MIDIDMXBRIDGE_SHOW_FILE_MAPPED_H__
+
+#ifndef ARDUINO
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "midi_dmx/ShowFile.h"
+
+/**
+ * @brief Host helper mapping a binary show file into memory.
+ *
+ * The show file is mapped read-only via `mmap()`, i.e. it is neither read nor copied on loading.
+ * Pages are fetched by the operating system once the scenes are accessed. Show files, e.g. compiled
+ * via the `extras/showc` tool, are limited to 64 KiB.
+ *
+ */
+class ShowFileMapped {
+ public:
+  /**
+   * @brief Construct a new ShowFileMapped object.
+   *
+   * @param[in] path the path of the show file, which must outlive the ShowFileMapped object
+   */
+  explicit ShowFileMapped(const char* path) : mPath(path), mData(nullptr), mSize(0) {}
+
+  /**
+   * @brief Destroy the ShowFileMapped object and unmap the show file.
+   *
+   * The show file must not be loaded into a bridge anymore.
+   *
+   */
+  ~ShowFileMapped() {
+    if (mData) {
+      munmap(mData, mSize);
+    }
+  }
+
+  ShowFileMapped(const ShowFileMapped&) = delete;
+  ShowFileMapped& operator=(const ShowFileMapped&) = delete;
+
+  /**
+   * @brief Map the show file into memory.
+   *
+   * @return true - the show file got mapped
+   * @return false - the show file could not be opened or exceeds 64 KiB
+   */
+  bool begin() {
+    if (!mData) {
+      const int fd = open(mPath, O_RDONLY);
+      struct stat info;
+
+      if ((fd >= 0) && (fstat(fd, &info) == 0) && (info.st_size > 0) &&
+          (info.st_size <= 0xffff)) {
+        void* data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data != MAP_FAILED) {
+          mData = data;
+          mSize = info.st_size;
+        }
+      }
+
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+
+    return mData != nullptr;
+  }
+
+  /**
+   * @brief Get the show file for mididmxbridge::BasicMidiDmxBridge::loadShow().
+   *
+   * @return mididmxbridge::dmx::ShowFile - the mapped show file, invalid if it is not mapped
+   */
+  mididmxbridge::dmx::ShowFile show() const {
+    return mididmxbridge::dmx::ShowFile(static_cast<const uint8_t*>(mData), (uint16_t)mSize);
+  }
+
+ private:
+  const char* mPath; /**< the path of the show file */
+  void* mData;       /**< the mapped show file */
+  size_t mSize;      /**< the size of the mapped show file in bytes */
+};
+#endif
+#endif
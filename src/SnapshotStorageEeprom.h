@@ -0,0 +1,70 @@
+/**
+ * @file SnapshotStorageEeprom.h
+ * @author Christian Neukam
+ * @brief Definition of the SnapshotStorageEeprom class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_SNAPSHOT_STORAGE_EEPROM_H__
+#define __MIDIDMXBRIDGE_SNAPSHOT_STORAGE_EEPROM_H__
+
+#if defined(ARDUINO) && defined(__AVR__)
+#include <avr/eeprom.h>
+
+#include "ISnapshotStorage.h"
+
+/**
+ * @brief Implementation of the mididmxbridge::ISnapshotStorage interface using the AVR EEPROM.
+ *
+ * The snapshot occupies a region of the EEPROM, so the remaining bytes stay available to the
+ * sketch. Unchanged bytes are not written, see `eeprom_update_byte()`. Each written byte takes
+ * about 3.3 ms, during which any further access waits. isReady() reports the end of the write, so
+ * the periodic snapshot never waits for the EEPROM.
+ *
+ */
+class SnapshotStorageEeprom : public mididmxbridge::ISnapshotStorage {
+ public:
+  /**
+   * @brief Construct a new SnapshotStorageEeprom object.
+   *
+   * The region is clipped to the EEPROM size of the board.
+   *
+   * @param[in] offset the first EEPROM address of the snapshot region
+   * @param[in] size the size of the snapshot region in bytes, the complete EEPROM by default
+   */
+  explicit SnapshotStorageEeprom(const uint16_t offset = 0, const uint16_t size = E2END + 1)
+      : mOffset(offset),
+        mSize((offset > E2END) ? 0 : ((size > E2END + 1 - offset) ? E2END + 1 - offset : size)) {}
+
+  uint16_t size() const override { return mSize; }
+
+  uint8_t read(const uint16_t address) override {
+    return eeprom_read_byte((const uint8_t*)(mOffset + address));
+  }
+
+  void write(const uint16_t address, const uint8_t value) override {
+    eeprom_update_byte((uint8_t*)(mOffset + address), value);
+  }
+
+  bool isReady() override { return eeprom_is_ready(); }
+
+ private:
+  uint16_t mOffset; /**< the first EEPROM address of the snapshot region */
+  uint16_t mSize;   /**< the size of the snapshot region in bytes */
+};
+#endif
+#endif
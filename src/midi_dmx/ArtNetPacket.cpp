@@ -0,0 +1,69 @@
+/**
+ * @file ArtNetPacket.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::dmx::ArtNetPacket class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ArtNetPacket.h"
+
+#ifndef ARDUINO
+#include <string.h>
+
+#include "util.h"
+
+namespace mididmxbridge::dmx {
+using namespace mididmxbridge::util;
+
+static const uint16_t kArtNetOpDmx = 0x5000;       /**< the ArtDmx operation code */
+static const uint16_t kArtNetProtocolVersion = 14; /**< the Art-Net protocol version */
+
+ArtNetPacket::ArtNetPacket(const uint16_t universe, const uint16_t slots)
+    : mSlots(min_t<uint16_t>(max_t<uint16_t>(slots + (slots & 0x01), 2), kDmxUniverseSize)),
+      mData{} {
+  memcpy(mData, "Art-Net", 8);
+  mData[8] = kArtNetOpDmx & 0xff;  // the operation code is little endian
+  mData[9] = kArtNetOpDmx >> 8;
+  mData[10] = kArtNetProtocolVersion >> 8;
+  mData[11] = kArtNetProtocolVersion & 0xff;
+  mData[12] = 1;  // sequence
+  mData[13] = 0;  // physical input port
+  mData[16] = mSlots >> 8;
+  mData[17] = mSlots & 0xff;
+  setUniverse(universe);
+}
+
+void ArtNetPacket::setUniverse(const uint16_t universe) {
+  mData[14] = universe & 0xff;
+  mData[15] = (universe >> 8) & 0x7f;
+}
+
+void ArtNetPacket::setChannel(const uint16_t channel, const uint8_t value) {
+  if (channel && (channel <= mSlots)) {
+    mData[kArtNetHeaderSize + channel - 1] = value;
+  }
+}
+
+void ArtNetPacket::nextSequence() { mData[12] = (mData[12] == 0xff) ? 1 : mData[12] + 1; }
+
+uint8_t* ArtNetPacket::payload() { return mData + kArtNetHeaderSize; }
+
+const uint8_t* ArtNetPacket::data() const { return mData; }
+
+uint16_t ArtNetPacket::size() const { return kArtNetHeaderSize + mSlots; }
+}  // namespace mididmxbridge::dmx
+#endif
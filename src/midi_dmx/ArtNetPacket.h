@@ -0,0 +1,117 @@
+/**
+ * @file ArtNetPacket.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::ArtNetPacket class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_ARTNET_PACKET_H__
+#define __MIDIDMXBRIDGE_ARTNET_PACKET_H__
+
+#ifndef ARDUINO
+#include <stdint.h>
+
+#include "constants.h"
+
+namespace mididmxbridge::dmx {
+const uint16_t kArtNetPort = 6454;    /**< the UDP port of Art-Net */
+const uint8_t kArtNetHeaderSize = 18; /**< the size of the ArtDmx header in bytes */
+
+/**
+ * @brief This class provides a preformatted Art-Net ArtDmx packet of one DMX universe.
+ *
+ * The DMX values are written directly into the payload of the packet, i.e. the packet is always
+ * ready for transmission. Sending the packet only requires to hand over data() and size() to the
+ * network interface, e.g. `sendto()` of an UDP socket on port ::kArtNetPort. After each
+ * transmission nextSequence() shall be called to maintain the sequence number of the packet.
+ *
+ * This class is only available on host systems.
+ *
+ */
+class ArtNetPacket {
+ public:
+  /**
+   * @brief Construct a new ArtNetPacket object.
+   *
+   * The number of \p slots is rounded up to an even number as required by the Art-Net
+   * specification and clipped to the range [2, ::kDmxUniverseSize].
+   *
+   * @param[in] universe the 15-bit Art-Net port address (net, sub-net and universe)
+   * @param[in] slots the number of DMX slots transmitted in the packet
+   */
+  ArtNetPacket(const uint16_t universe, const uint16_t slots = kDmxUniverseSize);
+
+  /**
+   * @brief Destroy the ArtNetPacket object.
+   *
+   */
+  virtual ~ArtNetPacket() = default;
+
+  /**
+   * @brief Set the 15-bit Art-Net port address of the packet.
+   *
+   * @param[in] universe the 15-bit Art-Net port address (net, sub-net and universe)
+   */
+  void setUniverse(const uint16_t universe);
+
+  /**
+   * @brief Set the DMX value of the channel in the payload of the packet.
+   *
+   * Channels outside of the range [1, slots] are ignored.
+   *
+   * @param[in] channel the DMX channel in the range [1, slots]
+   * @param[in] value the DMX value
+   */
+  void setChannel(const uint16_t channel, const uint8_t value);
+
+  /**
+   * @brief Increment the sequence number after the packet got transmitted.
+   *
+   * The sequence number cycles in the range [1, 255] as the value 0 disables the sequencing on the
+   * receiving node.
+   *
+   */
+  void nextSequence();
+
+  /**
+   * @brief Get the DMX payload of the packet, i.e. the DMX value of slot 1 is located at index 0.
+   *
+   * @return uint8_t* - the DMX payload of the packet
+   */
+  uint8_t* payload();
+
+  /**
+   * @brief Get the raw packet ready for transmission.
+   *
+   * @return const uint8_t* - the raw packet
+   */
+  const uint8_t* data() const;
+
+  /**
+   * @brief Get the size of the raw packet in bytes.
+   *
+   * @return uint16_t - the size of the packet
+   */
+  uint16_t size() const;
+
+ private:
+  uint16_t mSlots;                                     /**< the number of transmitted DMX slots */
+  uint8_t mData[kArtNetHeaderSize + kDmxUniverseSize]; /**< the raw packet */
+};
+}  // namespace mididmxbridge::dmx
+#endif
+#endif
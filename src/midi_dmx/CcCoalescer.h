@@ -0,0 +1,118 @@
+/**
+ * @file CcCoalescer.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::midi::CcCoalescer class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_MIDI_CC_COALESCER_H__
+#define __MIDIDMXBRIDGE_MIDI_CC_COALESCER_H__
+
+#include <stdint.h>
+
+#include "MidiMessage.h"
+#include "constants.h"
+
+namespace mididmxbridge::midi {
+/**
+ * @brief This class coalesces queued MIDI CC messages by keeping the newest value per controller.
+ *
+ * While the MIDI input is backlogged, e.g. by a fast fader sweep, the stale intermediate values of
+ * a controller are dropped. Only the newest value of each controller is applied, i.e. the DMX state
+ * catches up to real time in one step instead of replaying the history.
+ *
+ * @tparam Enabled the coalescing is enabled if true, no message is collected otherwise
+ */
+template <bool Enabled>
+class CcCoalescer {
+ public:
+  /**
+   * @brief Construct a new CcCoalescer object without collected messages.
+   *
+   */
+  CcCoalescer() : mValues(), mIsSet() {}
+
+  /**
+   * @brief Collect the MIDI message if it is a MIDI CC message.
+   *
+   * A previously collected value of the same controller is overwritten.
+   *
+   * @param[in] message the MIDI message to collect
+   * @return true - the \p message got collected
+   * @return false - the \p message is not a MIDI CC message and needs to be processed directly
+   */
+  bool add(const MidiMessage& message) {
+    const bool returnValue = (message.event == kMidiCc);
+
+    if (returnValue) {
+      const uint8_t controller = message.address & kMaxMidiValue;
+
+      mValues[controller] = message.value;
+      mIsSet[controller >> 3] |= (1 << (controller & 0x07));
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Emit the newest value of each collected controller and clear the collection.
+   *
+   * @tparam F the type of the function processing the MIDI messages
+   * @param[in] process the function called via `process(message)` per collected controller
+   */
+  template <class F>
+  void flush(F process) {
+    for (uint8_t idx = 0; idx < sizeof(mIsSet); idx++) {
+      for (uint8_t bit = 0; mIsSet[idx]; bit++) {
+        if (mIsSet[idx] & (1 << bit)) {
+          const uint8_t controller = (idx << 3) | bit;
+
+          mIsSet[idx] &= ~(1 << bit);
+          process(MidiMessage{kMidiCc, controller, mValues[controller]});
+        }
+      }
+    }
+  }
+
+ private:
+  uint8_t mValues[kMaxMidiValue + 1];      /**< the newest value per controller */
+  uint8_t mIsSet[(kMaxMidiValue + 1) / 8]; /**< the bitmask of the collected controllers */
+};
+
+/**
+ * @brief Specialization of CcCoalescer if the coalescing is disabled.
+ *
+ */
+template <>
+class CcCoalescer<false> {
+ public:
+  /**
+   * @brief Ignore the message as the coalescing is disabled.
+   *
+   * @return false - always
+   */
+  bool add(const MidiMessage&) { return false; }
+
+  /**
+   * @brief Nothing to emit as the coalescing is disabled.
+   *
+   */
+  template <class F>
+  void flush(F) {}
+};
+}  // namespace mididmxbridge::midi
+#endif
@@ -0,0 +1,146 @@
+/**
+ * @file ChannelGroupTable.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::midi::ChannelGroupTable class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_CHANNEL_GROUP_TABLE_H__
+#define __MIDIDMXBRIDGE_CHANNEL_GROUP_TABLE_H__
+
+#include <stdint.h>
+
+#include "DmxScene.h"
+#include "constants.h"
+#include "vector.h"
+
+namespace mididmxbridge::midi {
+/**
+ * @brief This class maps MIDI keys, i.e. notes or controllers, onto groups of DMX channels.
+ *
+ * The group of a key is found via a lookup table indexed by the key, i.e. the fan-out of a MIDI
+ * message onto its DMX channels costs no search.
+ *
+ * @tparam Slots the number of channel groups, 0 disables the channel groups
+ * @tparam GroupSize the maximum number of DMX channels per channel group
+ * @tparam Size the number of DMX channels of the universe
+ */
+template <uint8_t Slots, uint8_t GroupSize, uint16_t Size>
+class ChannelGroupTable {
+ public:
+  /**
+   * @brief Construct a new ChannelGroupTable object without any channel groups.
+   *
+   */
+  ChannelGroupTable() : mSlotOfKey(), mChannels(), mSizes(), mCount(0) {}
+
+  /**
+   * @brief Assign the group of DMX channels to the MIDI key.
+   *
+   * A previous assignment of the \p key is replaced. Channels exceeding \p GroupSize are ignored.
+   *
+   * @param[in] key the MIDI note or controller in the range [0, 127]
+   * @param[in] channels the DMX channels of the group, each below \p Size
+   * @return true - the group got assigned
+   * @return false - the \p key or a DMX channel is invalid or all channel groups are in use
+   */
+  bool set(const uint8_t key, const vector<uint16_t>& channels) {
+    bool returnValue = false;
+    const uint8_t count = (channels.size() < GroupSize) ? channels.size() : GroupSize;
+    bool isValid = (key <= kMaxMidiValue);
+
+    for (uint8_t idx = 0; isValid && (idx < count); idx++) {
+      isValid = (channels[idx] < Size);
+    }
+
+    if (isValid) {
+      uint8_t slot = mSlotOfKey[key];
+
+      if (!slot && (mCount < Slots)) {
+        slot = ++mCount;
+        mSlotOfKey[key] = slot;
+      }
+
+      if (slot) {
+        mSizes[slot - 1] = count;
+        for (uint8_t idx = 0; idx < count; idx++) {
+          mChannels[slot - 1][idx] = channels[idx];
+        }
+        returnValue = true;
+      }
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Call the function for each DMX channel of the group assigned to the MIDI key.
+   *
+   * @tparam F the type of the function called via `f(channel)`
+   * @param[in] key the MIDI note or controller
+   * @param[in] f the function to call
+   * @return true - the \p key has a group
+   * @return false - the \p key has no group
+   */
+  template <class F>
+  bool forEach(const uint8_t key, F f) const {
+    const uint8_t slot = (key <= kMaxMidiValue) ? mSlotOfKey[key] : 0;
+
+    for (uint8_t idx = 0; slot && (idx < mSizes[slot - 1]); idx++) {
+      f(mChannels[slot - 1][idx]);
+    }
+
+    return slot != 0;
+  }
+
+ private:
+  using Entry = typename dmx::DmxChannelEntry<(Size <= 256)>::Type;
+
+  uint8_t mSlotOfKey[kMaxMidiValue + 1]; /**< the group per key, 0 if unassigned */
+  Entry mChannels[Slots][GroupSize];     /**< the DMX channels per group */
+  uint8_t mSizes[Slots];                 /**< the number of DMX channels per group */
+  uint8_t mCount;                        /**< the number of assigned groups */
+};
+
+/**
+ * @brief Specialization of ChannelGroupTable without channel groups.
+ *
+ * @tparam GroupSize the maximum number of DMX channels per channel group
+ * @tparam Size the number of DMX channels of the universe
+ */
+template <uint8_t GroupSize, uint16_t Size>
+class ChannelGroupTable<0, GroupSize, Size> {
+ public:
+  /**
+   * @brief Reject the assignment.
+   *
+   * @return false - always
+   */
+  bool set(const uint8_t, const vector<uint16_t>&) { return false; }
+
+  /**
+   * @brief Ignore the request, as no key has a group.
+   *
+   * @return false - always
+   */
+  template <class F>
+  bool forEach(const uint8_t, F) const {
+    return false;
+  }
+};
+}  // namespace mididmxbridge::midi
+#endif
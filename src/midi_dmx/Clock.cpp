@@ -0,0 +1,40 @@
+/**
+ * @file Clock.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the millisecond clock
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Clock.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+namespace mididmxbridge::util {
+uint16_t clockMs() {
+#ifdef ARDUINO
+  return (uint16_t)millis();
+#else
+  static const auto start = std::chrono::steady_clock::now();
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return (uint16_t)std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+#endif
+}
+}  // namespace mididmxbridge::util
@@ -0,0 +1,39 @@
+/**
+ * @file Clock.h
+ * @author Christian Neukam
+ * @brief Definition of the millisecond clock
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_CLOCK_H__
+#define __MIDIDMXBRIDGE_CLOCK_H__
+
+#include <stdint.h>
+
+namespace mididmxbridge::util {
+/**
+ * @brief Get the time elapsed since the start of the program.
+ *
+ * The clock is based on `millis()` on Arduino boards and on `std::chrono::steady_clock` on host
+ * systems. Time spans must be calculated via unsigned subtraction, which is robust against the
+ * wrap around.
+ *
+ * @return uint16_t - the time in ms, wraps around
+ */
+uint16_t clockMs();
+}  // namespace mididmxbridge::util
+#endif
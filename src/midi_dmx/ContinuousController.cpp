@@ -28,8 +28,6 @@
 namespace mididmxbridge::midi {
 using namespace mididmxbridge::util;
 
-static const uint8_t kMidiToDmxFactor = 0x02; /**< scaling factor converting midi to dmx */
-
 ContinuousController::ContinuousController() : mController(0), mValue(0) {}
 
 ContinuousController::ContinuousController(const uint8_t controller, const uint8_t value)
@@ -43,8 +41,8 @@ bool ContinuousController::operator!=(const ContinuousController& rhs) const {
   return !(*this == rhs);
 }
 
-DmxValue ContinuousController::toDmx() const {
-  const uint8_t value = mValue * kMidiToDmxFactor;
+DmxValue ContinuousController::toDmx(const DmxCurve curve) const {
+  const uint8_t value = mididmxbridge::dmx::applyCurve(curve, mValue);
   return {mController, value};
 }
 }  // namespace mididmxbridge::midi
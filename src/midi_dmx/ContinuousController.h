@@ -24,12 +24,15 @@
 
 #include <stdint.h>
 
+#include "ResponseCurve.h"
+
 namespace mididmxbridge::dmx {
 class DmxValue; /**< forward declaration */
 }
 
 namespace mididmxbridge::midi {
 
+using mididmxbridge::dmx::DmxCurve;
 using mididmxbridge::dmx::DmxValue;
 
 /**
@@ -86,9 +89,12 @@ class ContinuousController {
   /**
    * @brief Convert the MIDI Continuous Controller command (CC) to a DMX command.
    *
+   * The MIDI CC value is mapped onto the full DMX range [0, 255] via the response \p curve.
+   *
+   * @param[in] curve the response curve to apply
    * @return mididmxbridge::dmx::DmxValue - the DMX value representing this MIDI CC command
    */
-  DmxValue toDmx() const;
+  DmxValue toDmx(const DmxCurve curve = mididmxbridge::dmx::kCurveLinear) const;
 
  private:
   const uint8_t mController; /**< the MIDI CC controller */
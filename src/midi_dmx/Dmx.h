@@ -1,7 +1,7 @@
 /**
  * @file Dmx.h
  * @author Christian Neukam
- * @brief Definition of the mididmxbridge::dmx::Dmx class
+ * @brief Definition and implementation of the mididmxbridge::dmx::BasicDmx class
  * @version 1.0
  * @date 2023-12-12
  *
@@ -22,33 +22,68 @@
 #ifndef __MIDIDMXBRIDGE_DMX_H__
 #define __MIDIDMXBRIDGE_DMX_H__
 
+#include "ContinuousController.h"
+#include "DmxScene.h"
+#include "DmxSink.h"
+#include "DmxSnapshot.h"
 #include "DmxTypes.h"
 #include "DmxValue.h"
+#include "GainKernel.h"
+#include "ISnapshotStorage.h"
+#include "MidiDmxBridgeConfig.h"
+#include "ResponseCurve.h"
+#include "ShowFile.h"
+#include "Trace.h"
 #include "constants.h"
+#include "util.h"
 #include "vector.h"
 
 namespace mididmxbridge::dmx {
+const uint16_t kGainDeadZone = 5;   /**< the offset specifying the dead zone for gain values */
+const uint8_t kDynamicScene = 0xff; /**< the scene index of the dynamic scene */
+
 /**
  * @brief This class provides the processing of DMX values.
  *
+ * The DMX values are emitted to the output sink \p Sink, which is any type that can be called via
+ * `sink(channel, value)`. As the sink is a compile-time type, the complete path from the MIDI input
+ * to the DMX output can be inlined by the compiler. The mididmxbridge::dmx::Dmx type uses the
+ * mididmxbridge::dmx::CallbackSink adapter to provide the DmxOnChangeCallback callback API.
+ *
+ * The last DMX value sent via the output sink is tracked per channel. The sink is only triggered if
+ * the scaled output value of a channel actually changes, e.g. distinct MIDI CC values that map to
+ * the same DMX value at a low gain do not trigger repeated outputs. A sink may report a dropped DMX
+ * value by returning `false`, e.g. once a queue is full, see mididmxbridge::dmx::callSink(). The
+ * dropped channels are flagged in a bit mask and sent again via resend().
+ *
+ * The capacities of the scenes are defined at compile-time via \p Config, see
+ * mididmxbridge::DefaultConfig.
+ *
+ * @tparam Sink the type of the DMX output sink
+ * @tparam Config the compile-time configuration
  */
-class Dmx {
+template <class Sink, class Config = DefaultConfig>
+class BasicDmx {
  public:
   /**
-   * @brief Construct a new Dmx object.
+   * @brief Construct a new BasicDmx object.
    *
-   * An object created via this constructor calls the registered callback as soon as the DMX values
-   * have changed.
+   * An object created via this constructor calls the output sink as soon as the DMX values have
+   * changed.
    *
-   * @param[in] callback the callback to trigger once the DMX values change
+   * @param[in] sink the output sink to trigger once the DMX values change
    */
-  Dmx(DmxOnChangeCallback callback);
+  BasicDmx(Sink sink)
+      : mActiveScene(kDynamicScene),
+        mGain(kUnityGainValue),
+        mSink(sink),
+        mDroppedCount(0) {}
 
   /**
-   * @brief Destroy the Dmx object.
+   * @brief Destroy the BasicDmx object.
    *
    */
-  virtual ~Dmx() = default;
+  virtual ~BasicDmx() = default;
 
   /**
    * @brief Set the DMX gain.
@@ -69,6 +104,37 @@ class Dmx {
    */
   void setDmxValue(const DmxValue& dmxValue);
 
+  /**
+   * @brief Stage the DMX value pair in the dynamic scene without triggering the output sink.
+   *
+   * The staged values are sent via the output sink by the next call of commit(). This way, a batch
+   * of DMX values is applied as a whole before the first output is triggered.
+   *
+   * @param[in] dmxValue the DMX value pair to stage
+   */
+  void stageDmxValue(const DmxValue& dmxValue);
+
+  /**
+   * @brief Send all DMX values staged via stageDmxValue() via the output sink.
+   *
+   * Only the channels whose output value actually changed trigger the output sink. Nothing is sent
+   * while a static scene is active.
+   *
+   */
+  void commit();
+
+  /**
+   * @brief Flash the DMX channel at the level or release it.
+   *
+   * The level is sent via the output sink immediately on top of the active scene, without changing
+   * any scene. Releasing the channel restores the value of the active scene. A following update of
+   * the channel in the active scene overrides the flash.
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] level the flash level, 0 releases the channel
+   */
+  void flash(const uint16_t channel, const uint8_t level);
+
   /**
    * @brief Set the DMX value pair based on MIDI CC values.
    *
@@ -78,34 +144,147 @@ class Dmx {
   void setMidiCcValue(const uint8_t midiCcController, const uint8_t midiCcValue);
 
   /**
-   * @brief Setup the static RGB scene.
+   * @brief Set the DMX channel of a channel group based on the MIDI CC value of the group.
+   *
+   * The MIDI CC value is mapped via the response curve of the DMX \p channel.
+   *
+   * @param[in] channel the DMX channel of the group
+   * @param[in] midiCcValue the input MIDI CC value
+   */
+  void setMidiCcChannel(const uint16_t channel, const uint8_t midiCcValue);
+
+  /**
+   * @brief Set the response curve applied to MIDI CC values of the DMX channel.
+   *
+   * The request is ignored unless the per-channel response curves are enabled via
+   * \p Config::kResponseCurves, all channels use the linear response curve in this case.
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] curve the response curve to apply
+   */
+  void setResponseCurve(const uint16_t channel, const DmxCurve curve);
+
+  /**
+   * @brief Setup the first static RGB scene.
    *
    * @param[in] channels the DMX channels associated with RGB
    * @param[in] rgb the RGB value to set
    */
   void setStaticScene(const DmxRgbChannels& channels, const DmxRgb& rgb);
 
+  /**
+   * @brief Setup the static RGB scene.
+   *
+   * The request is ignored if the \p scene exceeds the number of static scenes configured via
+   * \p Config::kStaticScenes.
+   *
+   * @param[in] scene the index of the static scene in the range [0, Config::kStaticScenes)
+   * @param[in] channels the DMX channels associated with RGB
+   * @param[in] rgb the RGB value to set
+   */
+  void setStaticScene(const uint8_t scene, const DmxRgbChannels& channels, const DmxRgb& rgb);
+
   /**
    * @brief Activate the static DMX scene.
    *
-   * Only either the dynamic scene or the static scene can be active. The last request takes
-   * over the scene.
+   * Only either the dynamic scene or one static scene can be active. The last request takes
+   * over the scene. The request is ignored if the \p scene exceeds the number of static scenes
+   * configured via \p Config::kStaticScenes.
    *
    * @see activateDynamicScene
    *
+   * @param[in] scene the index of the static scene in the range [0, Config::kStaticScenes)
    */
-  void activateStaticScene();
+  void activateStaticScene(const uint8_t scene = 0);
 
   /**
-   * @brief Activate the dynamic DMX scene.77Only either the dynamic scene or the static scene can
-   * be active. The last request takes over the scene.
+   * @brief Activate the dynamic DMX scene.
+   *
+   * Only either the dynamic scene or one static scene can be active. The last request takes
+   * over the scene.
    *
    * @see activateStaticScene
    *
    */
   void activateDynamicScene();
 
+  /**
+   * @brief Send all DMX values output so far via the output sink again.
+   *
+   * This restores the DMX state of an output stage which lost DMX values. All set channels are
+   * flagged as dropped, i.e. they are sent as long as the sink accepts them and the remaining
+   * values follow via resend().
+   *
+   */
+  void refresh();
+
+  /**
+   * @brief Send the DMX values dropped by the output sink again.
+   *
+   * Only the flagged channels are sent, in ascending channel order until the sink drops a value
+   * again, i.e. the work per call is bounded by the values the sink accepts. The flag of a channel
+   * is cleared once the sink accepts its value.
+   *
+   */
+  void resend();
+
+  /**
+   * @brief Load the show file, whose scenes and response curves replace the static scenes and
+   * response curves set up via setStaticScene() and setResponseCurve().
+   *
+   * The show file is accessed in place, i.e. loading takes constant time and swapping show files
+   * takes effect immediately. An active static scene is blacked out and the scene with the same
+   * index of the new show file is sent. The request is ignored unless the show files are enabled
+   * via \p Config::kShowFile.
+   *
+   * @param[in] show the show file, whose data must stay valid while it is loaded
+   * @return true - the show file got loaded
+   * @return false - the show file is invalid or show files are disabled
+   */
+  bool loadShow(const ShowFile& show);
+
+  /**
+   * @brief Restore the dynamic scene and the gain from the snapshot in the storage.
+   *
+   * The restored DMX values are sent via the output sink in one go if the dynamic scene is active.
+   * The storage is kept for the following snapshots. The request is ignored unless the snapshots
+   * are enabled via \p Config::kSnapshot.
+   *
+   * @param[in] storage the storage, which must outlive the BasicDmx object
+   * @return true - the snapshot got restored
+   * @return false - the storage holds no snapshot or snapshots are disabled
+   */
+  bool restoreSnapshot(ISnapshotStorage& storage);
+
+  /**
+   * @brief Store the changes of the dynamic scene and the gain since the last snapshot.
+   *
+   * @param[in] maxRecords the maximum number of records to write, ::kSnapshotAllRecords writes
+   *                       all changes
+   * @return true - the snapshot is complete
+   * @return false - changes are pending, as the \p maxRecords got exhausted
+   */
+  bool saveSnapshot(const uint8_t maxRecords = kSnapshotAllRecords);
+
+  /**
+   * @brief Take the periodic snapshot every \p Config::kSnapshotInterval ms.
+   *
+   * The changes are written at most one byte per call without waiting for the storage, see
+   * mididmxbridge::dmx::DmxSnapshot::update().
+   *
+   */
+  void updateSnapshot();
+
  private:
+  using Universe = DmxUniverse<Config::kUniverseSize>;
+  using Dropped = DmxChannelMask<Config::kUniverseSize>;
+  using StaticScene = vector<DmxValue, Config::kStaticSceneSize>;
+  using StaticScenes = DmxStaticScenes<Config::kStaticScenes, Config::kStaticSceneSize>;
+  using Curves = DmxCurves<Config::kResponseCurves ? Config::kUniverseSize : 0>;
+  using Show = ShowSlot<Config::kShowFile>;
+  using Snapshot = DmxSnapshot<Config::kSnapshot ? Config::kUniverseSize : 0>;
+  using Index = DmxChannelIndex<Config::kChannelIndex ? Config::kUniverseSize : 0>;
+
   /**
    * @brief Apply the supplied gain value to the DMX value.
    *
@@ -115,39 +294,367 @@ class Dmx {
   uint8_t scaleValue(const uint8_t value) const;
 
   /**
-   * @brief Update the current active DMX scene.
+   * @brief Get the response curve of the DMX channel, taken from the show file if one is loaded.
+   *
+   * @param[in] channel the DMX channel
+   * @return DmxCurve - the response curve of the \p channel
+   */
+  DmxCurve curve(const uint16_t channel) const;
+
+  /**
+   * @brief Get the value of the DMX channel in the active scene.
+   *
+   * @param[in] channel the DMX channel in the range [0, Config::kUniverseSize)
+   * @return uint8_t - the unscaled DMX value, 0 if the channel is not part of the active scene
+   */
+  uint8_t sceneValue(const uint16_t channel) const;
+
+  /**
+   * @brief Update the dynamic DMX scene.
    *
    * @param[in] dmxValue the DMX value pair to apply
-   * @return true - the active scene got updated
+   * @return true - the dynamic scene got updated
    * @return false - otherwise
    */
   bool updateScene(const DmxValue& dmxValue);
 
   /**
-   * @brief Send the currently selected scene via the DmxOnChangeCallback callback.
+   * @brief Activate the DMX scene.
+   *
+   * The currently active scene is blacked out before the new scene is sent.
+   *
+   * @param[in] scene the index of the scene to activate, i.e. ::kDynamicScene or a static scene
+   */
+  void activateScene(const uint8_t scene);
+
+  /**
+   * @brief Send the currently selected scene via the output sink.
+   *
+   * @param[in] blackout send zero values instead of the scene values if true
+   */
+  void sendScene(const bool blackout = false);
+
+  /**
+   * @brief Flag the DMX channel as dropped by the output sink or clear its flag.
    *
+   * @param[in] channel the DMX channel
+   * @param[in] isDropped true if the last value of the \p channel got dropped
    */
-  void sendScene() const;
+  void markDropped(const uint16_t channel, const bool isDropped);
 
   /**
-   * @brief Blackout the currently **not** selected scene via the DmxOnChangeCallback callback.
+   * @brief Send the DMX value via the output sink.
    *
+   * The sink is only triggered if the \p value differs from the last value sent on the same
+   * \p channel or if no value was sent on this \p channel so far.
+   *
+   * @param[in] channel the DMX channel to update
+   * @param[in] value the scaled DMX value to send
    */
-  void blackoutScene() const;
+  void sendValue(const uint16_t channel, const uint8_t value);
 
   /**
    * @brief Register the color value on the specified DMX channels.
    *
+   * @param[in] scene the static scene to assign the \p color to
    * @param[in] channels the DMX channels to assign the \p color to
    * @param[in] color the color value to assign
    */
-  void setRgbColor(const vector<uint8_t>& channels, const uint8_t color);
+  void setRgbColor(StaticScene& scene, const vector<uint8_t>& channels, const uint8_t color);
 
-  bool mUseDynamicScene;          /**< use the static scene if true, use dynamic otherwise */
-  vector<DmxValue> mStaticScene;  /**< the static scene description */
-  vector<DmxValue> mDynamicScene; /**< the dynamic scene description */
-  uint16_t mGain;                 /**< the current DMX gain factor */
-  DmxOnChangeCallback mCallback;  /**< the registered on-change callback */
+  uint8_t mActiveScene;       /**< the index of the active scene */
+  StaticScenes mStaticScenes; /**< the static scene descriptions */
+  Universe mDynamicScene;     /**< the dynamic scene description */
+  Index mIndex;               /**< the index of the set channels of the dynamic scene */
+  uint16_t mGain;             /**< the current DMX gain factor */
+  Sink mSink;                 /**< the DMX output sink */
+  Universe mOutput;           /**< the last DMX values sent per channel */
+  Dropped mDropped;           /**< the channels whose last value got dropped by the sink */
+  uint16_t mDroppedCount;     /**< the number of flagged channels of mDropped */
+  Curves mCurves;             /**< the response curves per channel */
+  Show mShow;                 /**< the loaded show file */
+  Snapshot mSnapshot;         /**< the snapshot of the dynamic scene */
 };
+
+/**
+ * @brief The DMX processing using the DmxOnChangeCallback callback API.
+ *
+ */
+using Dmx = BasicDmx<CallbackSink>;
+
+template <class Sink, class Config>
+uint8_t BasicDmx<Sink, Config>::scaleValue(const uint8_t value) const {
+  return dmx::scaleValue(value, mGain);
+}
+
+template <class Sink, class Config>
+DmxCurve BasicDmx<Sink, Config>::curve(const uint16_t channel) const {
+  const ShowFile* show = mShow.get();
+  return show ? show->curve(channel) : mCurves.get(channel);
+}
+
+template <class Sink, class Config>
+uint8_t BasicDmx<Sink, Config>::sceneValue(const uint16_t channel) const {
+  const auto* scene = mStaticScenes.get(mActiveScene);
+  const ShowFile* show = mShow.get();
+  uint8_t returnValue = 0;
+
+  if (show && (mActiveScene != kDynamicScene)) {
+    for (uint16_t idx = 0; idx < show->sceneSize(mActiveScene); idx++) {
+      const DmxValue dmxValue = show->sceneValue(mActiveScene, idx);
+
+      if (dmxValue.channel() == channel) {
+        returnValue = dmxValue.value();
+      }
+    }
+  } else if (scene) {
+    for (uint8_t idx = 0; idx < scene->size(); idx++) {
+      if ((*scene)[idx] && ((*scene)[idx].channel() == channel)) {
+        returnValue = (*scene)[idx].value();
+      }
+    }
+  } else if (mDynamicScene.isSet(channel)) {
+    returnValue = mDynamicScene.value(channel);
+  }
+
+  return returnValue;
+}
+
+template <class Sink, class Config>
+bool BasicDmx<Sink, Config>::updateScene(const DmxValue& dmxValue) {
+  bool sceneChanged = false;
+
+  if (dmxValue && (dmxValue.channel() < Config::kUniverseSize)) {
+    if (!mDynamicScene.isSet(dmxValue.channel())) {
+      mIndex.insert(dmxValue.channel());
+    }
+    sceneChanged = mDynamicScene.set(dmxValue.channel(), dmxValue.value());
+  }
+
+  if (sceneChanged) {
+    MIDIDMXBRIDGE_TRACE_EVENT(util::kTraceDmxUpdate + (dmxValue.channel() >> 8),
+                              dmxValue.channel(), dmxValue.value());
+  }
+
+  return sceneChanged;
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::sendValue(const uint16_t channel, const uint8_t value) {
+  if (mOutput.set(channel, value)) {
+    markDropped(channel, !callSink(mSink, channel, value));
+  }
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::markDropped(const uint16_t channel, const bool isDropped) {
+  if (isDropped && !mDropped.isSet(channel)) {
+    mDropped.set(channel);
+    mDroppedCount++;
+  } else if (!isDropped && mDropped.isSet(channel)) {
+    mDropped.clear(channel);
+    mDroppedCount--;
+  }
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::sendScene(const bool blackout) {
+  const auto* scene = mStaticScenes.get(mActiveScene);
+  const ShowFile* show = mShow.get();
+
+  if (show && (mActiveScene != kDynamicScene)) {
+    for (uint16_t idx = 0; idx < show->sceneSize(mActiveScene); idx++) {
+      const DmxValue dmxValue = show->sceneValue(mActiveScene, idx);
+
+      if (dmxValue.channel() < Config::kUniverseSize) {
+        sendValue(dmxValue.channel(), blackout ? 0 : scaleValue(dmxValue.value()));
+      }
+    }
+  } else if (scene) {
+    for (uint8_t idx = 0; idx < scene->size(); idx++) {
+      const auto& dmxValue = (*scene)[idx];
+
+      if (dmxValue) {
+        sendValue(dmxValue.channel(), blackout ? 0 : scaleValue(dmxValue.value()));
+      }
+    }
+  } else {
+    mIndex.forEachSet(mDynamicScene, [this, blackout](const uint16_t channel) {
+      sendValue(channel, blackout ? 0 : scaleValue(mDynamicScene.value(channel)));
+    });
+  }
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::setGain(const uint16_t gain) {
+  const bool isToSet = (util::absDiff_t(gain, mGain) > kGainDeadZone) ? true : false;
+
+  if (isToSet) {
+    mGain = util::min_t(gain, kUnityGainValue);
+    MIDIDMXBRIDGE_TRACE_EVENT(util::kTraceGain, mGain >> 8, mGain);
+    sendScene();
+  }
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::setDmxValue(const DmxValue& dmxValue) {
+  const bool triggerSink = updateScene(dmxValue) && (mActiveScene == kDynamicScene);
+
+  if (triggerSink) {
+    sendValue(dmxValue.channel(), scaleValue(dmxValue.value()));
+  }
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::stageDmxValue(const DmxValue& dmxValue) {
+  updateScene(dmxValue);
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::commit() {
+  if (mActiveScene == kDynamicScene) {
+    sendScene();
+  }
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::flash(const uint16_t channel, const uint8_t level) {
+  if (channel < Config::kUniverseSize) {
+    sendValue(channel, scaleValue(level ? level : sceneValue(channel)));
+  }
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::setMidiCcValue(const uint8_t midiCcController,
+                                            const uint8_t midiCcValue) {
+  const midi::ContinuousController cc{midiCcController, midiCcValue};
+  setDmxValue(cc.toDmx(curve(midiCcController)));
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::setMidiCcChannel(const uint16_t channel,
+                                              const uint8_t midiCcValue) {
+  setDmxValue(DmxValue{channel, applyCurve(curve(channel), midiCcValue)});
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::setResponseCurve(const uint16_t channel, const DmxCurve curve) {
+  mCurves.set(channel, curve);
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::setStaticScene(const DmxRgbChannels& channels, const DmxRgb& rgb) {
+  setStaticScene(0, channels, rgb);
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::setStaticScene(const uint8_t scene, const DmxRgbChannels& channels,
+                                            const DmxRgb& rgb) {
+  auto* staticScene = mStaticScenes.get(scene);
+
+  if (staticScene) {
+    setRgbColor(*staticScene, channels.red, rgb.red);
+    setRgbColor(*staticScene, channels.green, rgb.green);
+    setRgbColor(*staticScene, channels.blue, rgb.blue);
+  }
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::setRgbColor(StaticScene& scene, const vector<uint8_t>& channels,
+                                         const uint8_t color) {
+  for (uint8_t ch = 0; ch < channels.size(); ch++) {
+    if (channels[ch] < Config::kUniverseSize) {
+      scene.push_back(DmxValue{channels[ch], color});
+    }
+  }
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::activateScene(const uint8_t scene) {
+  if (scene != mActiveScene) {
+    MIDIDMXBRIDGE_TRACE_EVENT(util::kTraceScene, mActiveScene, scene);
+    sendScene(true);
+    mActiveScene = scene;
+    sendScene();
+  }
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::activateStaticScene(const uint8_t scene) {
+  const ShowFile* show = mShow.get();
+
+  if (show ? (scene < show->scenes()) : (mStaticScenes.get(scene) != nullptr)) {
+    activateScene(scene);
+  }
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::activateDynamicScene() {
+  activateScene(kDynamicScene);
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::refresh() {
+  mOutput.forEachSet([this](const uint16_t channel) { markDropped(channel, true); });
+  resend();
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::resend() {
+  bool isAccepted = true;
+
+  // the scan stops sending at the first drop, the remaining channels stay flagged
+  if (mDroppedCount) {
+    mDropped.forEachSet([this, &isAccepted](const uint16_t channel) {
+      isAccepted = isAccepted && callSink(mSink, channel, mOutput.value(channel));
+      markDropped(channel, !isAccepted);
+    });
+  }
+}
+
+template <class Sink, class Config>
+bool BasicDmx<Sink, Config>::loadShow(const ShowFile& show) {
+  bool isLoaded = false;
+
+  if (Config::kShowFile && show.isValid()) {
+    const bool isStaticScene = (mActiveScene != kDynamicScene);
+
+    if (isStaticScene) {
+      sendScene(true);
+    }
+
+    isLoaded = mShow.load(show);
+
+    if (isStaticScene) {
+      sendScene();
+    }
+  }
+
+  return isLoaded;
+}
+
+template <class Sink, class Config>
+bool BasicDmx<Sink, Config>::restoreSnapshot(ISnapshotStorage& storage) {
+  const bool isRestored =
+      mSnapshot.restore(storage, mGain, [this](const uint16_t channel, const uint8_t value) {
+        updateScene(DmxValue{channel, value});
+      });
+
+  if (isRestored && (mActiveScene == kDynamicScene)) {
+    sendScene();
+  }
+
+  return isRestored;
+}
+
+template <class Sink, class Config>
+bool BasicDmx<Sink, Config>::saveSnapshot(const uint8_t maxRecords) {
+  return mSnapshot.save(mDynamicScene, mGain, maxRecords);
+}
+
+template <class Sink, class Config>
+void BasicDmx<Sink, Config>::updateSnapshot() {
+  mSnapshot.update(mDynamicScene, mGain, Config::kSnapshotInterval);
+}
 }  // namespace mididmxbridge::dmx
 #endif
@@ -0,0 +1,61 @@
+/**
+ * @file DmxFrame.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::dmx::DmxFrame class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "DmxFrame.h"
+
+#include "util.h"
+
+namespace mididmxbridge::dmx {
+using namespace mididmxbridge::util;
+
+DmxFrame::DmxFrame(const uint16_t slots, const uint8_t startCode)
+    : mSlots(min_t<uint16_t>(max_t<uint16_t>(slots, 1), kDmxUniverseSize)),
+      mBreakTime(kDmxBreakTime),
+      mMabTime(kDmxMinMabTime),
+      mData(new uint8_t[mSlots + 1]()) {
+  mData[0] = startCode;
+}
+
+DmxFrame::~DmxFrame() { delete[] mData; }
+
+void DmxFrame::setChannel(const uint16_t channel, const uint8_t value) {
+  if (channel && (channel <= mSlots)) {
+    mData[channel] = value;
+  }
+}
+
+void DmxFrame::setStartCode(const uint8_t startCode) { mData[0] = startCode; }
+
+void DmxFrame::setTiming(const uint16_t breakTime, const uint16_t mabTime) {
+  mBreakTime = max_t(breakTime, kDmxMinBreakTime);
+  mMabTime = max_t(mabTime, kDmxMinMabTime);
+}
+
+uint16_t DmxFrame::breakTime() const { return mBreakTime; }
+
+uint16_t DmxFrame::mabTime() const { return mMabTime; }
+
+uint16_t DmxFrame::slots() const { return mSlots; }
+
+const uint8_t* DmxFrame::data() const { return mData; }
+
+uint16_t DmxFrame::size() const { return mSlots + 1; }
+}  // namespace mididmxbridge::dmx
@@ -0,0 +1,141 @@
+/**
+ * @file DmxFrame.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::DmxFrame class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_DMX_FRAME_H__
+#define __MIDIDMXBRIDGE_DMX_FRAME_H__
+
+#include <stdint.h>
+
+#include "constants.h"
+
+namespace mididmxbridge::dmx {
+const uint8_t kDmxNullStartCode = 0x00; /**< the start code of a DMX512 dimmer frame */
+const uint16_t kDmxMinBreakTime = 92;   /**< the minimum break time in us sent by a transmitter */
+const uint16_t kDmxBreakTime = 176;     /**< the default break time in us */
+const uint16_t kDmxMinMabTime = 12;     /**< the minimum mark-after-break time in us */
+
+/**
+ * @brief This class provides a transmit-ready DMX512 frame.
+ *
+ * The frame consists of the start code followed by the DMX slots, i.e. the DMX value of channel 1
+ * is located at index 1 of data(). As the DMX values are updated in place, e.g. from within the
+ * mididmxbridge::DmxOnChangeCallback callback, a transmitter can stream the complete frame via a
+ * single DMA or interrupt-driven UART transfer at 250000 baud (8N2) after generating the break and
+ * the mark-after-break (MAB) with the configured timing.
+ *
+ */
+class DmxFrame {
+ public:
+  /**
+   * @brief Construct a new DmxFrame object.
+   *
+   * The number of \p slots is clipped to the range [1, ::kDmxUniverseSize].
+   *
+   * @param[in] slots the number of DMX slots transmitted in the frame
+   * @param[in] startCode the start code of the frame
+   */
+  DmxFrame(const uint16_t slots = kDmxUniverseSize, const uint8_t startCode = kDmxNullStartCode);
+
+  ///@{
+  /**
+   * @brief The DmxFrame object owns the frame buffer and is therefore not copyable.
+   *
+   */
+  DmxFrame(const DmxFrame&) = delete;
+  DmxFrame& operator=(const DmxFrame&) = delete;
+  ///@}
+
+  /**
+   * @brief Destroy the DmxFrame object.
+   *
+   */
+  virtual ~DmxFrame();
+
+  /**
+   * @brief Set the DMX value of the channel in the frame.
+   *
+   * Channels outside of the range [1, slots] are ignored.
+   *
+   * @param[in] channel the DMX channel in the range [1, slots]
+   * @param[in] value the DMX value
+   */
+  void setChannel(const uint16_t channel, const uint8_t value);
+
+  /**
+   * @brief Set the start code of the frame.
+   *
+   * @param[in] startCode the start code of the frame
+   */
+  void setStartCode(const uint8_t startCode);
+
+  /**
+   * @brief Set the timing of the break and the mark-after-break (MAB) preceding the frame.
+   *
+   * The times are limited to the minimum values ::kDmxMinBreakTime and ::kDmxMinMabTime.
+   *
+   * @param[in] breakTime the break time in us
+   * @param[in] mabTime the mark-after-break time in us
+   */
+  void setTiming(const uint16_t breakTime, const uint16_t mabTime);
+
+  /**
+   * @brief Get the break time preceding the frame.
+   *
+   * @return uint16_t - the break time in us
+   */
+  uint16_t breakTime() const;
+
+  /**
+   * @brief Get the mark-after-break (MAB) time preceding the frame.
+   *
+   * @return uint16_t - the mark-after-break time in us
+   */
+  uint16_t mabTime() const;
+
+  /**
+   * @brief Get the number of DMX slots transmitted in the frame.
+   *
+   * @return uint16_t - the number of DMX slots
+   */
+  uint16_t slots() const;
+
+  /**
+   * @brief Get the raw frame ready for transmission, starting with the start code.
+   *
+   * @return const uint8_t* - the raw frame
+   */
+  const uint8_t* data() const;
+
+  /**
+   * @brief Get the size of the raw frame in bytes, i.e. the number of slots plus the start code.
+   *
+   * @return uint16_t - the size of the frame
+   */
+  uint16_t size() const;
+
+ private:
+  const uint16_t mSlots; /**< the number of transmitted DMX slots */
+  uint16_t mBreakTime;   /**< the break time in us */
+  uint16_t mMabTime;     /**< the mark-after-break time in us */
+  uint8_t* mData;        /**< the raw frame */
+};
+}  // namespace mididmxbridge::dmx
+#endif
@@ -0,0 +1,143 @@
+/**
+ * @file DmxFrameBuffer.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::DmxFrameBuffer class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_DMX_FRAME_BUFFER_H__
+#define __MIDIDMXBRIDGE_DMX_FRAME_BUFFER_H__
+
+#include <stdint.h>
+
+#include "atomic.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief This class decouples the DMX state updates from an asynchronous DMX output.
+ *
+ * The DMX values are written into a back buffer and published as a whole via commit(). The output
+ * side, e.g. an interrupt service routine transmitting the DMX frames or a host output thread,
+ * fetches the latest committed frame via acquire() and always reads a consistent frame without
+ * locks. Publishing and fetching a frame swap buffer indices atomically, no frame is copied.
+ *
+ * Three buffers are used, so the writer never touches the frame currently read by the output side:
+ * the back buffer written by the DMX state, the pending buffer holding the latest committed frame
+ * and the front buffer read by the output side. As a buffer reused as back buffer misses the values
+ * of the frames committed in the meantime, only these changed channels are copied on commit().
+ *
+ * The class provides `setChannel(channel, value)`, i.e. it can be used as DMX output sink via
+ * mididmxbridge::dmx::ChannelSink. The writer side, i.e. setChannel() and commit(), and the output
+ * side, i.e. acquire(), may run in different threads or interrupt contexts, but each side must be
+ * used from a single context only.
+ *
+ * @tparam Size the number of DMX channels
+ */
+template <uint16_t Size>
+class DmxFrameBuffer {
+ public:
+  /**
+   * @brief Construct a new DmxFrameBuffer object with all channels set to zero.
+   *
+   */
+  DmxFrameBuffer() : mFrames(), mDirty(), mBack(0), mPending(1), mFront(2) {}
+
+  /**
+   * @brief Set the DMX value of the channel in the back buffer.
+   *
+   * Channels outside of the range [1, Size] are ignored.
+   *
+   * @param[in] channel the DMX channel in the range [1, Size]
+   * @param[in] value the DMX value
+   */
+  void setChannel(const uint16_t channel, const uint8_t value) {
+    if (channel && (channel <= Size)) {
+      const uint16_t slot = channel - 1;
+
+      if (mFrames[mBack][slot] != value) {
+        mFrames[mBack][slot] = value;
+
+        for (uint8_t buffer = 0; buffer < kBuffers; buffer++) {
+          if (buffer != mBack) {
+            mDirty[buffer][slot >> 3] |= (1 << (slot & 0x07));
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Publish the back buffer as the latest frame.
+   *
+   * The next call of acquire() fetches this frame. The writes following the commit are collected
+   * in a new back buffer.
+   *
+   */
+  void commit() {
+    const uint8_t committed = mBack;
+
+    mBack = util::atomicExchange(mPending, committed | kFresh) & kIndexMask;
+
+    // catch up with the channels changed since the new back buffer was written last
+    for (uint8_t idx = 0; idx < kMaskSize; idx++) {
+      for (uint8_t bit = 0; mDirty[mBack][idx]; bit++) {
+        if (mDirty[mBack][idx] & (1 << bit)) {
+          const uint16_t slot = ((uint16_t)idx << 3) | bit;
+
+          mFrames[mBack][slot] = mFrames[committed][slot];
+          mDirty[mBack][idx] &= ~(1 << bit);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Fetch the latest committed frame for the output.
+   *
+   * The frame remains valid and unchanged until the next call of acquire().
+   *
+   * @return const uint8_t* - the DMX values of the channels [1, Size]
+   */
+  const uint8_t* acquire() {
+    if (util::atomicLoad(mPending) & kFresh) {
+      mFront = util::atomicExchange(mPending, mFront) & kIndexMask;
+    }
+
+    return mFrames[mFront];
+  }
+
+  /**
+   * @brief Get the number of DMX channels of a frame.
+   *
+   * @return uint16_t - the number of DMX channels
+   */
+  static constexpr uint16_t size() { return Size; }
+
+ private:
+  static const uint8_t kBuffers = 3;                /**< the number of buffers */
+  static const uint8_t kFresh = 0x80;               /**< flags an unfetched pending frame */
+  static const uint8_t kIndexMask = 0x03;           /**< masks the buffer index */
+  static const uint16_t kMaskSize = (Size + 7) / 8; /**< the size of a dirty mask in bytes */
+
+  uint8_t mFrames[kBuffers][Size];     /**< the frame buffers */
+  uint8_t mDirty[kBuffers][kMaskSize]; /**< the channels to catch up with per buffer */
+  uint8_t mBack;                       /**< the index of the back buffer, writer side */
+  volatile uint8_t mPending;           /**< the index of the pending buffer, shared */
+  uint8_t mFront;                      /**< the index of the front buffer, output side */
+};
+}  // namespace mididmxbridge::dmx
+#endif
@@ -0,0 +1,167 @@
+/**
+ * @file DmxMerge.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::DmxMerge class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_DMX_MERGE_H__
+#define __MIDIDMXBRIDGE_DMX_MERGE_H__
+
+#include <stdint.h>
+
+#include "DmxScene.h"
+#include "MidiDmxBridgeConfig.h"
+#include "util.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief This enumeration defines how the DMX values of several inputs are merged per channel.
+ *
+ */
+enum DmxMergeMode : uint8_t {
+  kMergeHtp = 0, /**< highest takes precedence, e.g. for intensity channels */
+  kMergeLtp = 1  /**< latest takes precedence, e.g. for position or color channels */
+};
+
+/**
+ * @brief This class merges the DMX universes of several inputs into one DMX output.
+ *
+ * Each input, typically a mididmxbridge::BasicMidiDmxBridge listening to its own MIDI interface,
+ * emits its DMX values to the merge via the output sink returned by input(). The merged value of
+ * a channel is either the highest value of all inputs (HTP) or the value written last (LTP). The
+ * merge is recomputed incrementally: an update touches only the updated channel, and only an HTP
+ * channel whose highest value decreased is recomputed across the inputs. The output sink \p Sink
+ * is only triggered if the merged value of a channel actually changes.
+ *
+ * @tparam Sink the type of the DMX output sink
+ * @tparam Inputs the number of inputs
+ * @tparam Size the number of DMX channels
+ */
+template <class Sink, uint8_t Inputs, uint16_t Size = DefaultConfig::kUniverseSize>
+class DmxMerge {
+ public:
+  static_assert(Inputs > 0, "at least one input is required");
+
+  /**
+   * @brief This class adapts one input of the merge to the DMX output sink concept.
+   *
+   */
+  class Input {
+   public:
+    /**
+     * @brief Construct a new Input object.
+     *
+     * @param[in] merge the merge to forward the DMX values to
+     * @param[in] input the index of the input in the range [0, Inputs)
+     */
+    Input(DmxMerge& merge, const uint8_t input) : mMerge(merge), mInput(input) {}
+
+    /**
+     * @brief Forward the DMX value to the merge.
+     *
+     * @param[in] channel the DMX channel
+     * @param[in] value the DMX value
+     */
+    void operator()(const uint16_t channel, const uint8_t value) const {
+      mMerge.set(mInput, channel, value);
+    }
+
+   private:
+    DmxMerge& mMerge; /**< the merge */
+    uint8_t mInput;   /**< the index of the input */
+  };
+
+  /**
+   * @brief Construct a new DmxMerge object with all channels merged via HTP.
+   *
+   * @param[in] sink the output sink to trigger once the merged DMX values change
+   */
+  DmxMerge(Sink sink) : mSink(sink), mValues(), mModes() {}
+
+  /**
+   * @brief Get the output sink of an input.
+   *
+   * @param[in] input the index of the input in the range [0, Inputs)
+   * @return Input - the output sink to pass to the bridge of the input
+   */
+  Input input(const uint8_t input) { return Input(*this, input); }
+
+  /**
+   * @brief Set the merge mode of the DMX channel.
+   *
+   * The new mode applies to the next update of the channel.
+   *
+   * @param[in] channel the DMX channel in the range [0, Size)
+   * @param[in] mode the merge mode
+   */
+  void setMode(const uint16_t channel, const DmxMergeMode mode) {
+    if (channel < Size) {
+      const uint8_t bit = 1 << (channel & 0x07);
+      mModes[channel >> 3] = (mode == kMergeLtp) ? (mModes[channel >> 3] | bit)
+                                                 : (mModes[channel >> 3] & ~bit);
+    }
+  }
+
+  /**
+   * @brief Update the DMX value of an input and send the merged value if it changed.
+   *
+   * Invalid inputs and channels are ignored.
+   *
+   * @param[in] input the index of the input in the range [0, Inputs)
+   * @param[in] channel the DMX channel in the range [0, Size)
+   * @param[in] value the DMX value
+   */
+  void set(const uint8_t input, const uint16_t channel, const uint8_t value) {
+    if ((input < Inputs) && (channel < Size)) {
+      const uint8_t previous = mValues[input][channel];
+      const uint8_t merged = mOutput.value(channel);
+      uint8_t output = merged;
+
+      mValues[input][channel] = value;
+
+      if ((mModes[channel >> 3] & (1 << (channel & 0x07))) || (value >= merged)) {
+        output = value;
+      } else if (previous == merged) {
+        // the highest value decreased, another input may hold the highest value now
+        output = value;
+        for (uint8_t idx = 0; idx < Inputs; idx++) {
+          output = util::max_t(output, mValues[idx][channel]);
+        }
+      }
+
+      if (mOutput.set(channel, output)) {
+        mSink(channel, output);
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the number of DMX channels of the merge.
+   *
+   * @return uint16_t - the number of DMX channels
+   */
+  static constexpr uint16_t size() { return Size; }
+
+ private:
+  Sink mSink;                      /**< the DMX output sink */
+  uint8_t mValues[Inputs][Size];   /**< the last DMX values per input */
+  uint8_t mModes[(Size + 7) >> 3]; /**< bit mask of the LTP channels */
+  DmxUniverse<Size> mOutput;       /**< the merged DMX values sent per channel */
+};
+}  // namespace mididmxbridge::dmx
+#endif
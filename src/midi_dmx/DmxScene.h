@@ -0,0 +1,336 @@
+/**
+ * @file DmxScene.h
+ * @author Christian Neukam
+ * @brief Definition of the DMX scene containers
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_DMX_SCENE_H__
+#define __MIDIDMXBRIDGE_DMX_SCENE_H__
+
+#include <stdint.h>
+
+#include "DmxValue.h"
+#include "vector.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief This class provides a bit mask holding one flag per DMX channel.
+ *
+ * @warning No bounds checking is performed.
+ *
+ * @tparam Size the number of DMX channels
+ */
+template <uint16_t Size>
+class DmxChannelMask {
+ public:
+  /**
+   * @brief Construct a new DmxChannelMask object with all flags cleared.
+   *
+   */
+  DmxChannelMask() : mBits{} {}
+
+  /**
+   * @brief Check whether the flag of the DMX channel is set.
+   *
+   * @param[in] channel the DMX channel in the range [0, Size)
+   * @return true if the flag is set
+   * @return false otherwise
+   */
+  bool isSet(const uint16_t channel) const { return mBits[channel >> 3] & (1 << (channel & 0x07)); }
+
+  /**
+   * @brief Set the flag of the DMX channel.
+   *
+   * @param[in] channel the DMX channel in the range [0, Size)
+   */
+  void set(const uint16_t channel) { mBits[channel >> 3] |= (1 << (channel & 0x07)); }
+
+  /**
+   * @brief Clear the flag of the DMX channel.
+   *
+   * @param[in] channel the DMX channel in the range [0, Size)
+   */
+  void clear(const uint16_t channel) { mBits[channel >> 3] &= ~(1 << (channel & 0x07)); }
+
+  /**
+   * @brief Call the function for each DMX channel with a set flag in ascending order.
+   *
+   * The bit mask is scanned byte-wise, i.e. eight cleared flags are skipped at once. The function
+   * may clear the flag of the passed channel.
+   *
+   * @tparam F the type of the function called via `f(channel)`
+   * @param[in] f the function to call
+   */
+  template <class F>
+  void forEachSet(F f) const {
+    for (uint16_t idx = 0; idx < sizeof(mBits); idx++) {
+      for (uint8_t bits = mBits[idx], bit = 0; bits; bits >>= 1, bit++) {
+        if (bits & 0x01) {
+          f((idx << 3) + bit);
+        }
+      }
+    }
+  }
+
+ private:
+  uint8_t mBits[(Size + 7) >> 3]; /**< the flags, one bit per channel */
+};
+
+/**
+ * @brief This class provides a statically allocated DMX universe.
+ *
+ * Next to the DMX value, the universe tracks whether a channel got actively set. The channel
+ * number is given by the index, so only one byte plus one bit is required per channel.
+ *
+ * @warning No bounds checking is performed.
+ *
+ * @tparam Size the number of DMX channels of the universe
+ */
+template <uint16_t Size>
+class DmxUniverse {
+ public:
+  /**
+   * @brief Construct a new DmxUniverse object.
+   *
+   * All channels are initially not set.
+   *
+   */
+  DmxUniverse() : mValues{}, mIsSet() {}
+
+  /**
+   * @brief Check whether the DMX channel got actively set.
+   *
+   * @param[in] channel the DMX channel in the range [0, Size)
+   * @return true if the channel got actively set
+   * @return false otherwise
+   */
+  bool isSet(const uint16_t channel) const { return mIsSet.isSet(channel); }
+
+  /**
+   * @brief Get the DMX value of the channel.
+   *
+   * @param[in] channel the DMX channel in the range [0, Size)
+   * @return uint8_t - the DMX value
+   */
+  uint8_t value(const uint16_t channel) const { return mValues[channel]; }
+
+  /**
+   * @brief Set the DMX value of the channel.
+   *
+   * @param[in] channel the DMX channel in the range [0, Size)
+   * @param[in] value the DMX value
+   * @return true - the channel was not set before or its value changed
+   * @return false - otherwise
+   */
+  bool set(const uint16_t channel, const uint8_t value) {
+    const bool changed = !isSet(channel) || (mValues[channel] != value);
+
+    mIsSet.set(channel);
+    mValues[channel] = value;
+
+    return changed;
+  }
+
+  /**
+   * @brief Call the function for each actively set DMX channel in ascending order.
+   *
+   * The bit mask is scanned byte-wise, i.e. eight unset channels are skipped at once.
+   *
+   * @tparam F the type of the function called via `f(channel)`
+   * @param[in] f the function to call
+   */
+  template <class F>
+  void forEachSet(F f) const {
+    mIsSet.forEachSet(f);
+  }
+
+  /**
+   * @brief Returns the number of DMX channels of the universe.
+   *
+   * @return uint16_t - the number of DMX channels
+   */
+  static constexpr uint16_t size() { return Size; }
+
+ private:
+  uint8_t mValues[Size];       /**< the DMX values */
+  DmxChannelMask<Size> mIsSet; /**< bit mask of the actively set channels */
+};
+
+/**
+ * @brief This struct selects the type of a channel index entry, i.e. a byte for small universes.
+ *
+ * @tparam IsByte true if all channels fit into one byte
+ */
+template <bool IsByte>
+struct DmxChannelEntry {
+  using Type = uint16_t; /**< the type of a channel index entry */
+};
+
+/**
+ * @brief Specialization of DmxChannelEntry for universes of up to 256 channels.
+ *
+ */
+template <>
+struct DmxChannelEntry<true> {
+  using Type = uint8_t; /**< the type of a channel index entry */
+};
+
+/**
+ * @brief This class provides a sorted index of the actively set channels of a DMX universe.
+ *
+ * Full-scene operations iterate the index instead of the universe, i.e. their cost scales with
+ * the channels in use rather than the universe size. As DMX channels are never unset, a channel is
+ * inserted once, when it is set for the first time.
+ *
+ * @tparam Size the number of DMX channels of the universe
+ */
+template <uint16_t Size>
+class DmxChannelIndex {
+ public:
+  /**
+   * @brief Construct a new DmxChannelIndex object.
+   *
+   */
+  DmxChannelIndex() : mChannels{}, mCount(0) {}
+
+  /**
+   * @brief Insert the DMX channel into the index, keeping the index sorted.
+   *
+   * The DMX channel must not be part of the index yet, i.e. it is only inserted on the first set.
+   *
+   * @param[in] channel the DMX channel in the range [0, Size)
+   */
+  void insert(const uint16_t channel) {
+    uint16_t pos = mCount;
+
+    while ((pos > 0) && (mChannels[pos - 1] > channel)) {
+      mChannels[pos] = mChannels[pos - 1];
+      pos--;
+    }
+
+    mChannels[pos] = channel;
+    mCount++;
+  }
+
+  /**
+   * @brief Call the function for each DMX channel of the index in ascending order.
+   *
+   * @tparam Universe the type of the indexed DMX universe
+   * @tparam F the type of the function called via `f(channel)`
+   * @param[in] f the function to call
+   */
+  template <class Universe, class F>
+  void forEachSet(const Universe&, F f) const {
+    for (uint16_t idx = 0; idx < mCount; idx++) {
+      f(mChannels[idx]);
+    }
+  }
+
+ private:
+  using Entry = typename DmxChannelEntry<(Size <= 256)>::Type;
+
+  Entry mChannels[Size]; /**< the sorted DMX channels */
+  uint16_t mCount;       /**< the number of DMX channels in the index */
+};
+
+/**
+ * @brief Specialization of DmxChannelIndex if the channel index is disabled.
+ *
+ * The actively set channels are found by scanning the bit mask of the universe.
+ *
+ */
+template <>
+class DmxChannelIndex<0> {
+ public:
+  /**
+   * @brief Ignore the request as the channel index is disabled.
+   *
+   */
+  void insert(const uint16_t) {}
+
+  /**
+   * @brief Call the function for each actively set DMX channel of the universe in ascending order.
+   *
+   * @tparam Universe the type of the DMX universe
+   * @tparam F the type of the function called via `f(channel)`
+   * @param[in] universe the DMX universe
+   * @param[in] f the function to call
+   */
+  template <class Universe, class F>
+  void forEachSet(const Universe& universe, F f) const {
+    universe.forEachSet(f);
+  }
+};
+
+/**
+ * @brief This class provides the storage of the static scenes.
+ *
+ * @tparam Count the number of static scenes
+ * @tparam Capacity the maximum number of DMX values per static scene
+ */
+template <uint8_t Count, uint8_t Capacity>
+class DmxStaticScenes {
+ public:
+  /**
+   * @brief Get the static scene.
+   *
+   * @param[in] scene the index of the static scene
+   * @return vector<DmxValue, Capacity>* - the static scene or nullptr if it does not exist
+   */
+  vector<DmxValue, Capacity>* get(const uint8_t scene) {
+    return (scene < Count) ? &mScenes[scene] : nullptr;
+  }
+
+  /**
+   * @brief Get the static scene for read access.
+   *
+   * @param[in] scene the index of the static scene
+   * @return const vector<DmxValue, Capacity>* - the static scene or nullptr if it does not exist
+   */
+  const vector<DmxValue, Capacity>* get(const uint8_t scene) const {
+    return (scene < Count) ? &mScenes[scene] : nullptr;
+  }
+
+ private:
+  vector<DmxValue, Capacity> mScenes[Count]; /**< the static scene descriptions */
+};
+
+/**
+ * @brief Specialization of the storage of the static scenes if static scenes are disabled.
+ *
+ * @tparam Capacity the maximum number of DMX values per static scene
+ */
+template <uint8_t Capacity>
+class DmxStaticScenes<0, Capacity> {
+ public:
+  /**
+   * @brief Get the static scene.
+   *
+   * @return vector<DmxValue, Capacity>* - always nullptr
+   */
+  vector<DmxValue, Capacity>* get(const uint8_t) { return nullptr; }
+
+  /**
+   * @brief Get the static scene for read access.
+   *
+   * @return const vector<DmxValue, Capacity>* - always nullptr
+   */
+  const vector<DmxValue, Capacity>* get(const uint8_t) const { return nullptr; }
+};
+}  // namespace mididmxbridge::dmx
+#endif
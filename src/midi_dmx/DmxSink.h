@@ -0,0 +1,183 @@
+/**
+ * @file DmxSink.h
+ * @author Christian Neukam
+ * @brief Definition of the DMX output sinks
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_DMX_SINK_H__
+#define __MIDIDMXBRIDGE_DMX_SINK_H__
+
+#include <stdint.h>
+
+#include "DmxTypes.h"
+#include "IDmxWriter.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief Call the DMX output sink, which reports whether it accepted the DMX value.
+ *
+ * @tparam S the type of the DMX output sink, callable via `bool sink(channel, value)`
+ * @param[in] sink the DMX output sink
+ * @param[in] channel the DMX channel
+ * @param[in] value the DMX value
+ * @return true - the DMX value got accepted
+ * @return false - the DMX value got dropped and needs to be sent again
+ */
+template <class S>
+auto callSink(S& sink, const uint16_t channel, const uint8_t value, int)
+    -> decltype(static_cast<bool>(sink(channel, value))) {
+  return sink(channel, value);
+}
+
+/**
+ * @brief Call the DMX output sink, which always accepts the DMX value.
+ *
+ * @tparam S the type of the DMX output sink, callable via `sink(channel, value)`
+ * @param[in] sink the DMX output sink
+ * @param[in] channel the DMX channel
+ * @param[in] value the DMX value
+ * @return true - always
+ */
+template <class S>
+bool callSink(S& sink, const uint16_t channel, const uint8_t value, long) {
+  sink(channel, value);
+  return true;
+}
+
+/**
+ * @brief Call the DMX output sink and check whether the DMX value got accepted.
+ *
+ * A sink returning `bool` reports a dropped DMX value via `false`, e.g. as its queue is full. A
+ * sink returning any other type always accepts the DMX value.
+ *
+ * @tparam S the type of the DMX output sink
+ * @param[in] sink the DMX output sink
+ * @param[in] channel the DMX channel
+ * @param[in] value the DMX value
+ * @return true - the DMX value got accepted
+ * @return false - the DMX value got dropped and needs to be sent again
+ */
+template <class S>
+bool callSink(S& sink, const uint16_t channel, const uint8_t value) {
+  return callSink(sink, channel, value, 0);
+}
+
+/**
+ * @brief This class adapts a mididmxbridge::DmxOnChangeCallback to the DMX output sink concept.
+ *
+ * A DMX output sink is any type that can be called via `sink(channel, value)` whenever a DMX value
+ * changes. A sink may return `bool` to report whether it accepted the DMX value, see callSink().
+ * As the sink type is a template parameter of mididmxbridge::dmx::BasicDmx, the call is
+ * dispatched statically and can be inlined by the compiler. This adapter keeps the runtime
+ * callback API available, at the cost of one indirect call per DMX value.
+ *
+ * As the callback signature uses 8-bit DMX channels, channels above 255 are not forwarded.
+ *
+ */
+class CallbackSink {
+ public:
+  /**
+   * @brief Construct a new CallbackSink object.
+   *
+   * @tparam F the type of the callback, i.e. any type convertible to DmxOnChangeCallback
+   * @param[in] callback the callback to trigger once the DMX values change
+   */
+  template <class F>
+  CallbackSink(const F& callback) : mCallback(callback) {}
+
+  /**
+   * @brief Forward the DMX value to the registered callback.
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] value the DMX value
+   */
+  void operator()(const uint16_t channel, const uint8_t value) const {
+    if (mCallback && (channel <= 0xff)) {
+      mCallback(channel, value);
+    }
+  }
+
+ private:
+  DmxOnChangeCallback mCallback; /**< the registered on-change callback */
+};
+
+/**
+ * @brief This class adapts an output stage providing `setChannel(channel, value)` to the DMX output
+ * sink concept, e.g. mididmxbridge::dmx::DmxFrame.
+ *
+ * @tparam T the type of the output stage
+ */
+template <class T>
+class ChannelSink {
+ public:
+  /**
+   * @brief Construct a new ChannelSink object.
+   *
+   * @param[in] target the output stage to forward the DMX values to
+   */
+  ChannelSink(T& target) : mTarget(target) {}
+
+  /**
+   * @brief Forward the DMX value to the output stage.
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] value the DMX value
+   */
+  void operator()(const uint16_t channel, const uint8_t value) const {
+    mTarget.setChannel(channel, value);
+  }
+
+ private:
+  T& mTarget; /**< the output stage */
+};
+
+/**
+ * @brief This class adapts a mididmxbridge::IDmxWriter to the DMX output sink concept, e.g.
+ * mididmxbridge::dmx::DmxWriteQueue.
+ *
+ * The DMX values are handed off via IDmxWriter::submit(), i.e. the DMX processing never waits for
+ * the actual output. Dropped values are reported to the DMX processing, which sends them again
+ * once the writer accepts values again.
+ *
+ */
+class WriterSink {
+ public:
+  /**
+   * @brief Construct a new WriterSink object.
+   *
+   * @param[in] writer the writer to submit the DMX values to
+   */
+  WriterSink(IDmxWriter& writer) : mWriter(writer) {}
+
+  /**
+   * @brief Submit the DMX value to the writer.
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] value the DMX value
+   * @return true - the DMX value got accepted
+   * @return false - the DMX value got dropped
+   */
+  bool operator()(const uint16_t channel, const uint8_t value) const {
+    return mWriter.submit(channel, value);
+  }
+
+ private:
+  IDmxWriter& mWriter; /**< the asynchronous writer */
+};
+}  // namespace mididmxbridge::dmx
+#endif
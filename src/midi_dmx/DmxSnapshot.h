@@ -0,0 +1,541 @@
+/**
+ * @file DmxSnapshot.h
+ * @author Christian Neukam
+ * @brief Definition of the wear-leveled DMX snapshot
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_DMX_SNAPSHOT_H__
+#define __MIDIDMXBRIDGE_DMX_SNAPSHOT_H__
+
+#include <stdint.h>
+
+#include "Clock.h"
+#include "DmxScene.h"
+#include "ISnapshotStorage.h"
+#include "constants.h"
+
+namespace mididmxbridge::dmx {
+const uint8_t kSnapshotRecordSize = 4;    /**< the size of a snapshot record in bytes */
+const uint8_t kSnapshotAllRecords = 0xff; /**< the record budget writing all pending records */
+
+/**
+ * @brief This class stores the dynamic scene and the gain in a non-volatile memory.
+ *
+ * The storage is organized as a ring of 4-byte records, each holding either the value of one DMX
+ * channel or the gain:
+ *
+ * | byte | content                                                                       |
+ * |------|-------------------------------------------------------------------------------|
+ * | 0    | tag: pass bit (7), marker `101` (6 - 4), gain flag (3), channel bits 9 - 8     |
+ * | 1    | channel bits 7 - 0 or the gain high byte                                      |
+ * | 2    | DMX value or the gain low byte                                                |
+ * | 3    | check byte, i.e. the XOR of the bytes 0 - 2 and 0xa5                          |
+ *
+ * Only the channels that changed since the last snapshot are appended to the ring, so the write
+ * cycles are spread evenly across the storage. The pass bit flips on each wrap around of the ring,
+ * which allows to find the oldest record on restore. The ring keeps at least one free record ahead
+ * of the next write: a record still holding the latest value of its channel is copied into this
+ * free record before its own place is reused. This way, the ring always contains the complete
+ * state, even if the power fails during a write, which requires the storage to hold more records
+ * than channels are in use. Records torn by a power loss fail the check and are skipped on restore.
+ * The index of the latest record is kept per channel in RAM, so checking whether a record can be
+ * overwritten costs one record read.
+ *
+ * The periodic snapshot via update() never waits for the storage: each call writes at most one
+ * byte and only once the storage is ready, see mididmxbridge::ISnapshotStorage::isReady(). A
+ * record in progress is continued by the next call. save() writes the records at once instead.
+ *
+ * @tparam Size the number of DMX channels of the universe
+ */
+template <uint16_t Size>
+class DmxSnapshot {
+ public:
+  /**
+   * @brief Construct a new DmxSnapshot object.
+   *
+   */
+  DmxSnapshot()
+      : mStorage(nullptr),
+        mRecords(0),
+        mHead(0),
+        mFree(0),
+        mPass(0),
+        mCursor(0),
+        mCopies(0),
+        mRecord(),
+        mRecordByte(kSnapshotRecordSize),
+        mLatest(),
+        mGain(kUnityGainValue),
+        mTime(0),
+        mIsPending(false) {}
+
+  /**
+   * @brief Attach the storage and restore the DMX values and the gain of the last snapshot.
+   *
+   * The storage shall be erased or hold a snapshot written by this class.
+   *
+   * @tparam F the type of the function called via `set(channel, value)`
+   * @param[in] storage the storage, which must outlive the DmxSnapshot object
+   * @param[in,out] gain the gain, which is only updated if the snapshot holds a gain
+   * @param[in] set the function applying a restored DMX value
+   * @return true - at least one record got restored
+   * @return false - the storage holds no snapshot
+   */
+  template <class F>
+  bool restore(ISnapshotStorage& storage, uint16_t& gain, F set) {
+    bool isRestored = false;
+    bool hasGain = false;
+
+    mStorage = &storage;
+    mRecords = storage.size() / kSnapshotRecordSize;
+    mGain = gain;
+    mFree = 0;
+    mRecordByte = kSnapshotRecordSize;
+    locateHead();
+
+    for (uint16_t key = 0; key <= kGainKey; key++) {
+      mLatest[key] = kNoRecord;
+    }
+
+    // the records are visited from the oldest to the newest one, i.e. the latest record wins
+    for (uint16_t idx = 0, record = mHead; idx < mRecords; idx++, record = next(record)) {
+      const uint16_t address = record * kSnapshotRecordSize;
+      const uint8_t tag = mStorage->read(address);
+      const uint8_t data0 = mStorage->read(address + 1);
+      const uint8_t data1 = mStorage->read(address + 2);
+
+      if (isValid(tag, data0, data1, mStorage->read(address + 3))) {
+        const uint16_t channel = ((tag & kChannelHigh) << 8) | data0;
+
+        if (tag & kGainFlag) {
+          mGain = (data0 << 8) | data1;
+          mLatest[kGainKey] = record;
+          hasGain = true;
+        } else if (channel < Size) {
+          mLogged.set(channel, data1);
+          mLatest[channel] = record;
+        }
+        isRestored = true;
+      }
+    }
+
+    mLogged.forEachSet([this, &set](const uint16_t channel) {
+      set(channel, mLogged.value(channel));
+    });
+    gain = hasGain ? mGain : gain;
+
+    return isRestored;
+  }
+
+  /**
+   * @brief Append the DMX values and the gain that changed since the last snapshot.
+   *
+   * The request is ignored unless a storage got attached via restore().
+   *
+   * @param[in] scene the scene to store
+   * @param[in] gain the gain to store
+   * @param[in] maxRecords the maximum number of records to write, ::kSnapshotAllRecords writes
+   *                       all changes
+   * @return true - the snapshot is complete
+   * @return false - changes are pending, as the \p maxRecords got exhausted
+   */
+  bool save(const DmxUniverse<Size>& scene, const uint16_t gain,
+            uint8_t maxRecords = kSnapshotAllRecords) {
+    bool isPending = false;
+
+    if (mStorage && (mRecords > 0)) {
+      const bool isUnlimited = (maxRecords == kSnapshotAllRecords);
+      uint8_t change[3];
+
+      completeRecord();
+
+      while (!isPending && findChange(scene, gain, change)) {
+        if (maxRecords > 0) {
+          takeChange(change);
+          append(change[0], change[1], change[2]);
+          maxRecords -= isUnlimited ? 0 : 1;
+        } else {
+          isPending = true;
+        }
+      }
+    }
+
+    return !isPending;
+  }
+
+  /**
+   * @brief Take the periodic snapshot without waiting for the storage.
+   *
+   * Once the \p interval expired, the changes are written byte by byte: each call writes at most
+   * one byte, and only if the storage is ready. This includes the records of the previous pass the
+   * ring preserves. The caller is never blocked by a pending write of the storage.
+   *
+   * @param[in] scene the scene to store
+   * @param[in] gain the gain to store
+   * @param[in] interval the snapshot interval in ms, 0 disables the periodic snapshot
+   */
+  void update(const DmxUniverse<Size>& scene, const uint16_t gain, const uint16_t interval) {
+    const bool isDue = mIsPending || ((uint16_t)(util::clockMs() - mTime) >= interval);
+
+    if (mStorage && (mRecords > 0) && (interval > 0) && mStorage->isReady()) {
+      if (isWriting()) {
+        writeByte();
+      } else if (isDue) {
+        uint8_t change[3];
+
+        mTime = util::clockMs();
+        mIsPending = true;
+
+        // the room for the change is made first, which may start the copy of a preserved record
+        if (makeRoom()) {
+          mIsPending = findChange(scene, gain, change);
+
+          if (mIsPending) {
+            takeChange(change);
+            beginRecord(change[0], change[1], change[2]);
+            mFree -= (mFree > 0) ? 1 : 0;
+          }
+        }
+
+        if (isWriting()) {
+          writeByte();
+        }
+      }
+    }
+  }
+
+ private:
+  static const uint8_t kPassFlag = 0x80;    /**< the pass bit of the tag */
+  static const uint8_t kMarkerMask = 0x70;  /**< masks the marker of the tag */
+  static const uint8_t kMarker = 0x50;      /**< the marker identifying a record */
+  static const uint8_t kGainFlag = 0x08;    /**< the tag flag of a gain record */
+  static const uint8_t kChannelHigh = 0x03; /**< masks the high channel bits of the tag */
+  static const uint8_t kCheckSeed = 0xa5;   /**< the seed of the check byte */
+  static const uint16_t kGainKey = Size;    /**< the index of the gain in the latest records */
+  static const uint16_t kNoRecord = 0xffff; /**< marks a channel without a record */
+
+  /**
+   * @brief Check whether the bytes form a valid record.
+   *
+   * @param[in] tag the tag byte
+   * @param[in] data0 the first data byte
+   * @param[in] data1 the second data byte
+   * @param[in] check the check byte
+   * @return true - the record is valid
+   * @return false - otherwise, e.g. erased or torn
+   */
+  static bool isValid(const uint8_t tag, const uint8_t data0, const uint8_t data1,
+                      const uint8_t check) {
+    return ((tag & kMarkerMask) == kMarker) && (check == (tag ^ data0 ^ data1 ^ kCheckSeed));
+  }
+
+  /**
+   * @brief Get the index of the record following the \p record in the ring.
+   *
+   * @param[in] record the index of the record
+   * @return uint16_t - the index of the next record
+   */
+  uint16_t next(const uint16_t record) const { return (record + 1 < mRecords) ? (record + 1) : 0; }
+
+  /**
+   * @brief Read the tag of the record, which is 0 if the record is invalid.
+   *
+   * @param[in] record the index of the record
+   * @return uint8_t - the tag of the valid record, 0 otherwise
+   */
+  uint8_t readTag(const uint16_t record) const {
+    const uint16_t address = record * kSnapshotRecordSize;
+    const uint8_t tag = mStorage->read(address);
+    const bool isRecord = isValid(tag, mStorage->read(address + 1), mStorage->read(address + 2),
+                                  mStorage->read(address + 3));
+
+    return isRecord ? tag : 0;
+  }
+
+  /**
+   * @brief Locate the oldest record, which is overwritten next, and the current pass.
+   *
+   * The current pass ends at the first record that is invalid or written in the previous pass.
+   *
+   */
+  void locateHead() {
+    const uint8_t first = (mRecords > 0) ? readTag(0) : 0;
+    const uint8_t last = (mRecords > 0) ? readTag(mRecords - 1) : 0;
+
+    // a record torn at the start of a pass continues the pass following the last record
+    mPass = first ? (first & kPassFlag) : (last ? ((last & kPassFlag) ^ kPassFlag) : 0);
+    mHead = 0;
+
+    while ((mHead < mRecords) && readTag(mHead) && ((readTag(mHead) & kPassFlag) == mPass)) {
+      mHead++;
+    }
+
+    if (mHead == mRecords) {
+      mHead = 0;
+      mPass ^= kPassFlag;
+    }
+  }
+
+  /**
+   * @brief Get the index of the latest record of the channel, or the gain respectively.
+   *
+   * @param[in] flags the gain flag and the high channel bits of the tag
+   * @param[in] data0 the first data byte
+   * @return uint16_t - the index into the latest records, kGainKey for the gain and kNoRecord for
+   *                    channels outside the universe
+   */
+  static uint16_t keyOf(const uint8_t flags, const uint8_t data0) {
+    const uint16_t channel = ((flags & kChannelHigh) << 8) | data0;
+
+    return (flags & kGainFlag) ? kGainKey : ((channel < Size) ? channel : kNoRecord);
+  }
+
+  /**
+   * @brief Check whether the record can be overwritten, i.e. it is invalid or it does not hold the
+   * latest value of its channel, or the gain respectively.
+   *
+   * @param[in] record the index of the record
+   * @return true - the record is free
+   * @return false - the record holds the latest value of its channel or the gain
+   */
+  bool isFree(const uint16_t record) const {
+    const uint8_t tag = readTag(record);
+    const uint16_t key = keyOf(tag, mStorage->read(record * kSnapshotRecordSize + 1));
+
+    return (tag == 0) || (key == kNoRecord) || (mLatest[key] != record);
+  }
+
+  /**
+   * @brief Find the next change to store, i.e. the gain or the next changed channel starting at the
+   * cursor, which is moved onto the changed channel.
+   *
+   * A single pass over the universe visits each pending channel, the cursor spreads partial
+   * snapshots across all channels.
+   *
+   * @param[in] scene the scene to store
+   * @param[in] gain the gain to store
+   * @param[out] change the flags, the first and the second data byte of the record
+   * @return true - a change got found
+   * @return false - the storage holds the current scene and gain
+   */
+  bool findChange(const DmxUniverse<Size>& scene, const uint16_t gain, uint8_t change[3]) {
+    bool isChanged = (gain != mGain);
+
+    if (isChanged) {
+      change[0] = kGainFlag;
+      change[1] = gain >> 8;
+      change[2] = gain & 0xff;
+    }
+
+    for (uint16_t idx = 0; !isChanged && (idx < Size); idx++) {
+      const uint16_t channel = mCursor;
+      const uint8_t value = scene.value(channel);
+
+      isChanged = scene.isSet(channel) &&
+                  (!mLogged.isSet(channel) || (mLogged.value(channel) != value));
+
+      if (isChanged) {
+        change[0] = channel >> 8;
+        change[1] = channel & 0xff;
+        change[2] = value;
+      } else {
+        mCursor = (mCursor + 1 < Size) ? (mCursor + 1) : 0;
+      }
+    }
+
+    return isChanged;
+  }
+
+  /**
+   * @brief Take the change as stored and move the cursor past a changed channel.
+   *
+   * @param[in] change the change found via findChange()
+   */
+  void takeChange(const uint8_t change[3]) {
+    if (change[0] & kGainFlag) {
+      mGain = (change[1] << 8) | change[2];
+    } else {
+      mLogged.set(((change[0] & kChannelHigh) << 8) | change[1], change[2]);
+      mCursor = (mCursor + 1 < Size) ? (mCursor + 1) : 0;
+    }
+    mCopies = 0;
+  }
+
+  /**
+   * @brief Check whether a record is in progress.
+   *
+   * @return true - bytes of the record at the head are pending
+   * @return false - otherwise
+   */
+  bool isWriting() const { return mRecordByte < kSnapshotRecordSize; }
+
+  /**
+   * @brief Start the record at the head, whose bytes are written via writeByte().
+   *
+   * @param[in] flags the gain flag and the high channel bits of the tag
+   * @param[in] data0 the first data byte
+   * @param[in] data1 the second data byte
+   */
+  void beginRecord(const uint8_t flags, const uint8_t data0, const uint8_t data1) {
+    mRecord[0] = mPass | kMarker | flags;
+    mRecord[1] = data0;
+    mRecord[2] = data1;
+    mRecord[3] = mRecord[0] ^ data0 ^ data1 ^ kCheckSeed;
+    mRecordByte = 0;
+  }
+
+  /**
+   * @brief Write the next byte of the record in progress, the head is advanced after the last one.
+   *
+   * The check byte is written last, so a torn record fails the check.
+   *
+   */
+  void writeByte() {
+    mStorage->write(mHead * kSnapshotRecordSize + mRecordByte, mRecord[mRecordByte]);
+    mRecordByte++;
+
+    if (!isWriting()) {
+      const uint16_t key = keyOf(mRecord[0], mRecord[1]);
+
+      if (key != kNoRecord) {
+        mLatest[key] = mHead;
+      }
+      mHead = next(mHead);
+      mPass ^= (mHead == 0) ? kPassFlag : 0;
+    }
+  }
+
+  /**
+   * @brief Write the remaining bytes of the record in progress at once.
+   *
+   */
+  void completeRecord() {
+    while (isWriting()) {
+      writeByte();
+    }
+  }
+
+  /**
+   * @brief Keep two free records ahead of the head, i.e. one for the next write and one preserving
+   * the latest record of a channel while its place is reused.
+   *
+   * A record still holding the latest value of its channel is copied into the free record at the
+   * head. The copies are bounded by the ring size, i.e. a ring too small for the channels in use
+   * overwrites the oldest record.
+   *
+   * @return true - there is room for the next change
+   * @return false - the copy of a preserved record got started, which needs to be completed first
+   */
+  bool makeRoom() {
+    bool isRoom = false;
+    bool isCopy = false;
+
+    while (!isRoom && !isCopy) {
+      const uint16_t record = (mHead + mFree) % mRecords;
+      const uint16_t address = record * kSnapshotRecordSize;
+
+      if ((mFree >= 2) || (mFree >= mRecords) || (mCopies >= mRecords)) {
+        isRoom = true;
+      } else if (isFree(record)) {
+        mFree++;
+      } else if (mFree > 0) {
+        // the copy frees the record, i.e. the free window moves on
+        beginRecord(mStorage->read(address) & (kGainFlag | kChannelHigh),
+                    mStorage->read(address + 1), mStorage->read(address + 2));
+        mCopies++;
+        isCopy = true;
+      } else {
+        // the ring holds the latest records only, the oldest one is overwritten
+        isRoom = true;
+      }
+    }
+
+    return isRoom;
+  }
+
+  /**
+   * @brief Append the record to the ring preserving the latest record of each channel.
+   *
+   * The records are written at once.
+   *
+   * @param[in] flags the gain flag and the high channel bits of the tag
+   * @param[in] data0 the first data byte
+   * @param[in] data1 the second data byte
+   */
+  void append(const uint8_t flags, const uint8_t data0, const uint8_t data1) {
+    while (!makeRoom()) {
+      completeRecord();
+    }
+
+    beginRecord(flags, data0, data1);
+    completeRecord();
+    mFree -= (mFree > 0) ? 1 : 0;
+  }
+
+  ISnapshotStorage* mStorage;           /**< the attached storage */
+  uint16_t mRecords;                    /**< the number of records of the storage */
+  uint16_t mHead;                       /**< the index of the record to write next */
+  uint16_t mFree;                       /**< the number of free records starting at the head */
+  uint8_t mPass;                        /**< the pass bit of the records written next */
+  uint16_t mCursor;                     /**< the channel the next partial snapshot starts with */
+  uint16_t mCopies;                     /**< the records copied since the last change */
+  uint8_t mRecord[kSnapshotRecordSize]; /**< the bytes of the record in progress */
+  uint8_t mRecordByte;                  /**< the next byte to write, the size if idle */
+  DmxUniverse<Size> mLogged;            /**< the DMX values stored so far */
+  uint16_t mLatest[Size + 1];           /**< the latest record per channel and of the gain */
+  uint16_t mGain;                       /**< the gain stored so far */
+  uint16_t mTime;                       /**< the time of the last periodic snapshot in ms */
+  bool mIsPending;                      /**< true while a periodic snapshot is incomplete */
+};
+
+/**
+ * @brief Specialization of DmxSnapshot if the snapshots are disabled.
+ *
+ */
+template <>
+class DmxSnapshot<0> {
+ public:
+  /**
+   * @brief Ignore the request as the snapshots are disabled.
+   *
+   * @return false - always
+   */
+  template <class F>
+  bool restore(ISnapshotStorage&, uint16_t&, F) {
+    return false;
+  }
+
+  /**
+   * @brief Ignore the request as the snapshots are disabled.
+   *
+   * @return true - always
+   */
+  template <uint16_t Size>
+  bool save(const DmxUniverse<Size>&, const uint16_t, uint8_t = kSnapshotAllRecords) {
+    return true;
+  }
+
+  /**
+   * @brief Ignore the request as the snapshots are disabled.
+   *
+   */
+  template <uint16_t Size>
+  void update(const DmxUniverse<Size>&, const uint16_t, const uint16_t) {}
+};
+}  // namespace mididmxbridge::dmx
+#endif
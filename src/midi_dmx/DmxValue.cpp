@@ -24,7 +24,7 @@
 namespace mididmxbridge::dmx {
 DmxValue::DmxValue() : mIsSet(false), mChannel(0), mValue(0) {}
 
-DmxValue::DmxValue(const uint8_t channel, const uint8_t value)
+DmxValue::DmxValue(const uint16_t channel, const uint8_t value)
     : mIsSet(true), mChannel(channel), mValue(value) {}
 
 DmxValue& DmxValue::operator=(const DmxValue& rhs) {
@@ -45,7 +45,7 @@ bool DmxValue::operator!=(const DmxValue& rhs) const { return !(*this == rhs); }
 
 DmxValue::operator bool() const { return mIsSet; }
 
-uint8_t DmxValue::channel() const { return mChannel; }
+uint16_t DmxValue::channel() const { return mChannel; }
 
 uint8_t DmxValue::value() const { return mValue; }
 }  // namespace mididmxbridge::dmx
@@ -0,0 +1,139 @@
+/**
+ * @file DmxWriteQueue.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::DmxWriteQueue class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_DMX_WRITE_QUEUE_H__
+#define __MIDIDMXBRIDGE_DMX_WRITE_QUEUE_H__
+
+#include <stdint.h>
+
+#include "IDmxWriter.h"
+#include "atomic.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief This class queues DMX values for an asynchronous output.
+ *
+ * The DMX processing submits the changed DMX values via submit(), which returns immediately. The
+ * output side writes the queued values via drain() at its own pace, e.g. from the main loop, an
+ * interrupt service routine or a host output thread. The queue is bounded: values submitted to a
+ * full queue are dropped and reported via the return value of submit() and via overflowed(). Used
+ * via mididmxbridge::dmx::WriterSink, the dropped values are sent again by the DMX processing once
+ * the queue accepts values again.
+ *
+ * The class implements mididmxbridge::IDmxWriter, i.e. it can be used as DMX output sink via
+ * mididmxbridge::dmx::WriterSink. The submitting side, i.e. submit(), and the output side, i.e.
+ * drain() and overflowed(), may run in different threads or interrupt contexts, but each side must
+ * be used from a single context only.
+ *
+ * @tparam Capacity the maximum number of queued DMX values in the range [1, 254]
+ */
+template <uint8_t Capacity>
+class DmxWriteQueue : public IDmxWriter {
+ public:
+  static_assert((Capacity > 0) && (Capacity < 0xff), "invalid queue capacity");
+
+  /**
+   * @brief Construct a new empty DmxWriteQueue object.
+   *
+   */
+  DmxWriteQueue() : mChannels(), mValues(), mHead(0), mTail(0), mOverflow(0) {}
+
+  /**
+   * @brief Queue the DMX value for output.
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] value the DMX value
+   * @return true - the DMX value got queued
+   * @return false - the DMX value got dropped as the queue is full
+   */
+  bool submit(const uint16_t channel, const uint8_t value) override {
+    const uint8_t next = advance(mTail);
+    bool isQueued = false;
+
+    if (next != util::atomicLoad(mHead)) {
+      mChannels[mTail] = channel;
+      mValues[mTail] = value;
+      util::atomicStore(mTail, next);
+      isQueued = true;
+    } else {
+      util::atomicStore(mOverflow, 1);
+    }
+
+    return isQueued;
+  }
+
+  /**
+   * @brief Write the queued DMX values in submission order.
+   *
+   * @tparam F the type of the write operation, callable via `write(channel, value)`
+   * @param[in] write the write operation performing the actual output
+   * @param[in] maxValues the maximum number of DMX values to write
+   * @return uint8_t - the number of DMX values written
+   */
+  template <class F>
+  uint8_t drain(F write, const uint8_t maxValues = Capacity) {
+    const uint8_t tail = util::atomicLoad(mTail);
+    uint8_t written = 0;
+
+    while ((mHead != tail) && (written < maxValues)) {
+      write(mChannels[mHead], mValues[mHead]);
+      util::atomicStore(mHead, advance(mHead));
+      written++;
+    }
+
+    return written;
+  }
+
+  /**
+   * @brief Check whether DMX values got dropped since the last call and reset the indication.
+   *
+   * @return true - at least one DMX value got dropped
+   * @return false - otherwise
+   */
+  bool overflowed() { return util::atomicExchange(mOverflow, 0); }
+
+  /**
+   * @brief Check whether the queue is empty.
+   *
+   * @return true - no DMX value is queued
+   * @return false - otherwise
+   */
+  bool isEmpty() const { return util::atomicLoad(mHead) == util::atomicLoad(mTail); }
+
+ private:
+  static const uint8_t kSlots = Capacity + 1; /**< one slot stays free to detect a full queue */
+
+  /**
+   * @brief Get the slot following the given one.
+   *
+   * @param[in] slot the slot index
+   * @return uint8_t - the index of the next slot
+   */
+  static uint8_t advance(const uint8_t slot) { return (slot + 1 < kSlots) ? slot + 1 : 0; }
+
+  uint16_t mChannels[kSlots]; /**< the queued DMX channels */
+  uint8_t mValues[kSlots];    /**< the queued DMX values */
+  volatile uint8_t mHead;     /**< the next slot to write, output side */
+  volatile uint8_t mTail;     /**< the next slot to fill, submitting side */
+  volatile uint8_t mOverflow; /**< set once a DMX value got dropped, shared */
+};
+}  // namespace mididmxbridge::dmx
+#endif
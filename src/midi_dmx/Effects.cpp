@@ -0,0 +1,64 @@
+/**
+ * @file Effects.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the effect waveforms
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Effects.h"
+
+#include "pgmspace.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief Quarter period of a sine wave with an amplitude of 127.
+ *
+ */
+static const uint8_t kQuarterSine[64] PROGMEM = {
+    2,   5,   8,   11,  14,  17,  20,  23,  26,  29,  32,  35,  38,  41,  44,  47,
+    50,  53,  56,  58,  61,  64,  67,  69,  72,  74,  77,  79,  82,  84,  86,  89,
+    91,  93,  95,  97,  99,  101, 103, 105, 106, 108, 110, 111, 113, 114, 115, 117,
+    118, 119, 120, 121, 122, 123, 124, 124, 125, 125, 126, 126, 127, 127, 127, 127};
+
+uint8_t evaluateWaveform(const DmxWaveform waveform, const uint16_t phase) {
+  const uint8_t index = phase >> 8;
+  uint8_t value;
+
+  switch (waveform) {
+    case kWaveformSine: {
+      const uint8_t quadrant = index >> 6;
+      const uint8_t offset = (quadrant & 0x01) ? (63 - (index & 0x3f)) : (index & 0x3f);
+      const uint8_t amplitude = pgm_read_byte(&kQuarterSine[offset]);
+      value = (quadrant & 0x02) ? (128 - amplitude) : (128 + amplitude);
+      break;
+    }
+    case kWaveformTriangle:
+      value = (index & 0x80) ? ((255 - index) << 1) : (index << 1);
+      break;
+    case kWaveformSquare:
+      value = (index & 0x80) ? 0 : 255;
+      break;
+    default:
+      value = 0;
+      break;
+  }
+
+  return value;
+}
+
+uint16_t midiToRate(const uint8_t value) { return ((uint16_t)value * value) >> 4; }
+}  // namespace mididmxbridge::dmx
@@ -0,0 +1,248 @@
+/**
+ * @file Effects.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::EffectsEngine class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_EFFECTS_H__
+#define __MIDIDMXBRIDGE_EFFECTS_H__
+
+#include <stdint.h>
+
+#include "Clock.h"
+
+namespace mididmxbridge::dmx {
+const uint8_t kNoController = 0xff; /**< disables the MIDI CC control of an effect parameter */
+
+/**
+ * @brief This enumeration defines the waveforms of an effect.
+ *
+ */
+enum DmxWaveform : uint8_t {
+  kWaveformSine = 0,     /**< sine low frequency oscillator (LFO) */
+  kWaveformTriangle = 1, /**< triangle low frequency oscillator (LFO) */
+  kWaveformSquare = 2,   /**< square low frequency oscillator (LFO) */
+  kWaveformChase = 3     /**< step chase lighting one channel of the group after the other */
+};
+
+/**
+ * @brief This struct defines an effect running on a group of consecutive DMX channels.
+ *
+ * The effect is driven by a 16-bit phase accumulator, i.e. one period of the waveform corresponds
+ * to 65536 phase steps. The phase is advanced by \p rate steps per ms, so the speed of the effect
+ * does not depend on how often it is evaluated, e.g. a rate of 66 results in a period of about 1 s.
+ *
+ */
+struct DmxEffect {
+  DmxWaveform waveform;    /**< the waveform of the effect */
+  uint16_t firstChannel;   /**< the first DMX channel of the group */
+  uint8_t channels;        /**< the number of DMX channels of the group */
+  uint16_t rate;           /**< the phase increment per ms */
+  uint8_t depth;           /**< the modulation depth in the range [0, 255] */
+  uint16_t spread;         /**< the phase offset between adjacent channels of an LFO */
+  uint8_t rateController;  /**< the MIDI CC controlling the rate or ::kNoController */
+  uint8_t depthController; /**< the MIDI CC controlling the depth or ::kNoController */
+};
+
+/**
+ * @brief Evaluate the waveform at the given phase.
+ *
+ * The waveforms are computed with integer arithmetic only, the sine is based on a quarter-wave
+ * table stored in the program memory.
+ *
+ * @param[in] waveform the LFO waveform, i.e. sine, triangle or square
+ * @param[in] phase the phase in the range [0, 65535] covering one period
+ * @return uint8_t - the value of the waveform in the range [0, 255]
+ */
+uint8_t evaluateWaveform(const DmxWaveform waveform, const uint16_t phase);
+
+/**
+ * @brief Convert a MIDI CC value into the phase increment per ms of an effect.
+ *
+ * The mapping is quadratic to provide a fine resolution for slow effects. The periods range from
+ * about 65 s down to 65 ms.
+ *
+ * @param[in] value the MIDI CC value in the range [0, 127]
+ * @return uint16_t - the phase increment per ms
+ */
+uint16_t midiToRate(const uint8_t value);
+
+/**
+ * @brief This class provides the evaluation of effects.
+ *
+ * The phases of the effects advance with the time elapsed between two evaluations, see
+ * mididmxbridge::util::clockMs().
+ *
+ * @tparam Count the number of effect slots
+ */
+template <uint8_t Count>
+class EffectsEngine {
+ public:
+  /**
+   * @brief Construct a new EffectsEngine object.
+   *
+   * All effect slots are initially inactive.
+   *
+   */
+  EffectsEngine() : mSlots{}, mTime(util::clockMs()) {}
+
+  /**
+   * @brief Start an effect in the given slot.
+   *
+   * The request is ignored if the \p slot exceeds the number of effect slots.
+   *
+   * @param[in] slot the effect slot in the range [0, Count)
+   * @param[in] effect the effect to run
+   */
+  void setEffect(const uint8_t slot, const DmxEffect& effect) {
+    if (slot < Count) {
+      mSlots[slot].effect = effect;
+      mSlots[slot].phase = 0;
+      mSlots[slot].active = true;
+    }
+  }
+
+  /**
+   * @brief Stop the effect in the given slot.
+   *
+   * The DMX channels of the effect keep their last value.
+   *
+   * @param[in] slot the effect slot in the range [0, Count)
+   */
+  void clearEffect(const uint8_t slot) {
+    if (slot < Count) {
+      mSlots[slot].active = false;
+    }
+  }
+
+  /**
+   * @brief Apply a MIDI CC value to the effect parameters controlled by the MIDI CC.
+   *
+   * @param[in] controller the MIDI CC controller
+   * @param[in] value the MIDI CC value in the range [0, 127]
+   * @return true - the MIDI CC controls at least one effect parameter
+   * @return false - otherwise
+   */
+  bool setMidiCcValue(const uint8_t controller, const uint8_t value) {
+    bool returnValue = false;
+
+    for (uint8_t idx = 0; idx < Count; idx++) {
+      auto& slot = mSlots[idx];
+
+      if (slot.active && (slot.effect.rateController == controller)) {
+        slot.effect.rate = midiToRate(value);
+        returnValue = true;
+      }
+
+      if (slot.active && (slot.effect.depthController == controller)) {
+        slot.effect.depth = (value << 1) | (value >> 6);
+        returnValue = true;
+      }
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Evaluate all active effects at the current time.
+   *
+   * @tparam F the type of the output function
+   * @param[in] write the output function called via `write(channel, value)` per effect channel
+   */
+  template <class F>
+  void update(F write) {
+    const uint16_t now = util::clockMs();
+    const uint16_t elapsed = now - mTime;
+
+    mTime = now;
+
+    for (uint8_t idx = 0; idx < Count; idx++) {
+      auto& slot = mSlots[idx];
+
+      if (slot.active) {
+        const DmxEffect& effect = slot.effect;
+
+        slot.phase += (uint16_t)((uint32_t)effect.rate * elapsed);
+
+        for (uint8_t ch = 0; ch < effect.channels; ch++) {
+          uint8_t value;
+
+          if (effect.waveform == kWaveformChase) {
+            const uint8_t step = ((uint32_t)slot.phase * effect.channels) >> 16;
+            value = (ch == step) ? effect.depth : 0;
+          } else {
+            const uint16_t phase = slot.phase + ch * effect.spread;
+            value = ((uint16_t)evaluateWaveform(effect.waveform, phase) * effect.depth) >> 8;
+          }
+
+          write(effect.firstChannel + ch, value);
+        }
+      }
+    }
+  }
+
+ private:
+  /**
+   * @brief The state of an effect slot.
+   *
+   */
+  struct Slot {
+    DmxEffect effect; /**< the effect description */
+    uint16_t phase;   /**< the current phase of the effect */
+    bool active;      /**< indicates if the effect is running */
+  };
+
+  Slot mSlots[Count]; /**< the effect slots */
+  uint16_t mTime;     /**< the time of the last evaluation in ms */
+};
+
+/**
+ * @brief Specialization of the effects engine if effects are disabled.
+ *
+ */
+template <>
+class EffectsEngine<0> {
+ public:
+  /**
+   * @brief Ignore the effect as no effect slots are available.
+   *
+   */
+  void setEffect(const uint8_t, const DmxEffect&) {}
+
+  /**
+   * @brief Ignore the request as no effect slots are available.
+   *
+   */
+  void clearEffect(const uint8_t) {}
+
+  /**
+   * @brief Ignore the MIDI CC value as no effect slots are available.
+   *
+   * @return false - always
+   */
+  bool setMidiCcValue(const uint8_t, const uint8_t) { return false; }
+
+  /**
+   * @brief Nothing to evaluate as no effect slots are available.
+   *
+   */
+  template <class F>
+  void update(F) {}
+};
+}  // namespace mididmxbridge::dmx
+#endif
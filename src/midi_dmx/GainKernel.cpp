@@ -0,0 +1,184 @@
+/**
+ * @file GainKernel.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the DMX gain kernels
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "GainKernel.h"
+
+#include <string.h>
+
+#include "util.h"
+
+#if !defined(ARDUINO) && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define MIDIDMXBRIDGE_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace mididmxbridge::dmx {
+using namespace mididmxbridge::util;
+
+/**
+ * @brief Signature of a gain kernel processing a complete DMX universe.
+ *
+ * The gain passed to the kernel is in the range [0, ::kUnityGainValue).
+ *
+ */
+using GainKernel = void (*)(const uint8_t* input, uint8_t* output, const uint16_t size,
+                            const uint16_t gain);
+
+/**
+ * @brief Portable scalar gain kernel.
+ *
+ * @param[in] input the raw DMX values
+ * @param[out] output the scaled DMX values
+ * @param[in] size the number of DMX values to scale
+ * @param[in] gain the integer based gain in the range [0, ::kUnityGainValue)
+ */
+static void scaleScalar(const uint8_t* input, uint8_t* output, const uint16_t size,
+                        const uint16_t gain) {
+  for (uint16_t idx = 0; idx < size; idx++) {
+    output[idx] = scaleValue(input[idx], gain);
+  }
+}
+
+#ifdef MIDIDMXBRIDGE_X86_KERNELS
+/*
+ * The SIMD kernels compute (value * gain) >> kAnalogReadBits as the high word of the 16-bit
+ * product value * (gain << (16 - kAnalogReadBits)). As the gain is below ::kUnityGainValue, the
+ * shifted gain fits into 16 bits and the result is bit-exact to scaleValue().
+ */
+
+/**
+ * @brief SSE2 gain kernel processing 16 DMX values per iteration.
+ *
+ * @param[in] input the raw DMX values
+ * @param[out] output the scaled DMX values
+ * @param[in] size the number of DMX values to scale
+ * @param[in] gain the integer based gain in the range [0, ::kUnityGainValue)
+ */
+__attribute__((target("sse2"))) static void scaleSse2(const uint8_t* input, uint8_t* output,
+                                                      const uint16_t size, const uint16_t gain) {
+  const __m128i factor = _mm_set1_epi16((short)(gain << (16 - kAnalogReadBits)));
+  const __m128i zero = _mm_setzero_si128();
+  uint16_t idx = 0;
+
+  for (; idx + 16 <= size; idx += 16) {
+    const __m128i values = _mm_loadu_si128((const __m128i*)(input + idx));
+    const __m128i lo = _mm_mulhi_epu16(_mm_unpacklo_epi8(values, zero), factor);
+    const __m128i hi = _mm_mulhi_epu16(_mm_unpackhi_epi8(values, zero), factor);
+    _mm_storeu_si128((__m128i*)(output + idx), _mm_packus_epi16(lo, hi));
+  }
+
+  scaleScalar(input + idx, output + idx, size - idx, gain);
+}
+
+/**
+ * @brief AVX2 gain kernel processing 32 DMX values per iteration.
+ *
+ * @param[in] input the raw DMX values
+ * @param[out] output the scaled DMX values
+ * @param[in] size the number of DMX values to scale
+ * @param[in] gain the integer based gain in the range [0, ::kUnityGainValue)
+ */
+__attribute__((target("avx2"))) static void scaleAvx2(const uint8_t* input, uint8_t* output,
+                                                      const uint16_t size, const uint16_t gain) {
+  const __m256i factor = _mm256_set1_epi16((short)(gain << (16 - kAnalogReadBits)));
+  const __m256i zero = _mm256_setzero_si256();
+  uint16_t idx = 0;
+
+  for (; idx + 32 <= size; idx += 32) {
+    const __m256i values = _mm256_loadu_si256((const __m256i*)(input + idx));
+    const __m256i lo = _mm256_mulhi_epu16(_mm256_unpacklo_epi8(values, zero), factor);
+    const __m256i hi = _mm256_mulhi_epu16(_mm256_unpackhi_epi8(values, zero), factor);
+    _mm256_storeu_si256((__m256i*)(output + idx), _mm256_packus_epi16(lo, hi));
+  }
+
+  // the SSE2 kernel uses legacy encoded instructions, which stall on dirty upper AVX registers
+  _mm256_zeroupper();
+  scaleSse2(input + idx, output + idx, size - idx, gain);
+}
+#endif
+
+#ifdef MIDIDMXBRIDGE_X86_KERNELS
+/**
+ * @brief Select the fastest gain kernel supported by the CPU.
+ *
+ * @return GainKernel - the selected gain kernel
+ */
+static GainKernel selectKernel() {
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx2")) {
+    return scaleAvx2;
+  }
+
+  if (__builtin_cpu_supports("sse2")) {
+    return scaleSse2;
+  }
+
+  return scaleScalar;
+}
+#endif
+
+void scaleUniverse(const uint8_t* input, uint8_t* output, const uint16_t size,
+                   const uint16_t gain) {
+#ifdef MIDIDMXBRIDGE_X86_KERNELS
+  static const GainKernel kernel = selectKernel();
+#else
+  const GainKernel kernel = scaleScalar;
+#endif
+
+  if (gain >= kUnityGainValue) {
+    if (input != output) {
+      memmove(output, input, size);
+    }
+  } else {
+    kernel(input, output, size, gain);
+  }
+}
+
+void scaleUniverseScalar(const uint8_t* input, uint8_t* output, const uint16_t size,
+                         const uint16_t gain) {
+  scaleScalar(input, output, size, min_t(gain, kUnityGainValue));
+}
+
+bool scaleUniverseVia(const GainKernelType type, const uint8_t* input, uint8_t* output,
+                      const uint16_t size, const uint16_t gain) {
+  GainKernel kernel = (type == kGainKernelScalar) ? scaleScalar : nullptr;
+
+#ifdef MIDIDMXBRIDGE_X86_KERNELS
+  __builtin_cpu_init();
+
+  if ((type == kGainKernelSse2) && __builtin_cpu_supports("sse2")) {
+    kernel = scaleSse2;
+  } else if ((type == kGainKernelAvx2) && __builtin_cpu_supports("avx2")) {
+    kernel = scaleAvx2;
+  }
+#endif
+
+  // the kernels require a gain below unity, which is a plain copy
+  if (kernel && (gain >= kUnityGainValue)) {
+    memmove(output, input, size);
+  } else if (kernel) {
+    kernel(input, output, size, gain);
+  }
+
+  return kernel != nullptr;
+}
+}  // namespace mididmxbridge::dmx
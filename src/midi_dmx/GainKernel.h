@@ -0,0 +1,101 @@
+/**
+ * @file GainKernel.h
+ * @author Christian Neukam
+ * @brief Definition of the DMX gain kernels
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_GAIN_KERNEL_H__
+#define __MIDIDMXBRIDGE_GAIN_KERNEL_H__
+
+#include <stdint.h>
+
+#include "constants.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief The implementations of the universe gain kernel.
+ *
+ */
+enum GainKernelType : uint8_t {
+  kGainKernelScalar = 0, /**< the portable scalar implementation */
+  kGainKernelSse2 = 1,   /**< the x86 SSE2 implementation processing 16 DMX values at once */
+  kGainKernelAvx2 = 2,   /**< the x86 AVX2 implementation processing 32 DMX values at once */
+};
+
+/**
+ * @brief Apply the gain to a single DMX value.
+ *
+ * This is the reference implementation of the DMX gain, all other gain kernels are bit-exact to
+ * this function.
+ *
+ * @param[in] value the DMX value to scale
+ * @param[in] gain the integer based gain in the range [0, ::kUnityGainValue]
+ * @return uint8_t - the scaled DMX value
+ */
+inline uint8_t scaleValue(const uint8_t value, const uint16_t gain) {
+  return ((uint32_t)value * (uint32_t)gain) >> kAnalogReadBits;
+}
+
+/**
+ * @brief Apply the gain to a complete DMX universe.
+ *
+ * On x86 host systems, the universe is processed via SSE2 or AVX2 depending on the instruction
+ * set supported by the CPU at runtime. A portable scalar implementation is used otherwise. All
+ * implementations are bit-exact to mididmxbridge::dmx::scaleValue().
+ *
+ * The \p input and \p output buffers may be identical for in-place processing.
+ *
+ * @param[in] input the raw DMX values
+ * @param[out] output the scaled DMX values
+ * @param[in] size the number of DMX values to scale
+ * @param[in] gain the integer based gain, which is clipped to the range [0, ::kUnityGainValue]
+ */
+void scaleUniverse(const uint8_t* input, uint8_t* output, const uint16_t size,
+                   const uint16_t gain);
+
+/**
+ * @brief Apply the gain to a complete DMX universe via the portable scalar implementation.
+ *
+ * @see scaleUniverse
+ *
+ * @param[in] input the raw DMX values
+ * @param[out] output the scaled DMX values
+ * @param[in] size the number of DMX values to scale
+ * @param[in] gain the integer based gain, which is clipped to the range [0, ::kUnityGainValue]
+ */
+void scaleUniverseScalar(const uint8_t* input, uint8_t* output, const uint16_t size,
+                         const uint16_t gain);
+
+/**
+ * @brief Apply the gain to a complete DMX universe via the given implementation, e.g. to compare
+ * the implementations in a benchmark.
+ *
+ * @see scaleUniverse
+ *
+ * @param[in] type the implementation to use
+ * @param[in] input the raw DMX values
+ * @param[out] output the scaled DMX values
+ * @param[in] size the number of DMX values to scale
+ * @param[in] gain the integer based gain, which is clipped to the range [0, ::kUnityGainValue]
+ * @return true - the universe got scaled
+ * @return false - the implementation is not supported by the build or the CPU
+ */
+bool scaleUniverseVia(const GainKernelType type, const uint8_t* input, uint8_t* output,
+                      const uint16_t size, const uint16_t gain);
+}  // namespace mididmxbridge::dmx
+#endif
@@ -0,0 +1,111 @@
+/**
+ * @file MidiMessage.h
+ * @author Christian Neukam
+ * @brief Definition of the messages decoded from the MIDI input
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_MIDI_MESSAGE_H__
+#define __MIDIDMXBRIDGE_MIDI_MESSAGE_H__
+
+#include <stdint.h>
+
+#include "util.h"
+
+namespace mididmxbridge::midi {
+/**
+ * @brief This enumeration defines the events decoded from the MIDI input.
+ *
+ */
+enum MidiEvent : uint8_t {
+  kMidiCc = 0,        /**< a MIDI Continuous Controller (CC) */
+  kMidiDumpValue = 1, /**< a DMX value of a SysEx channel dump */
+  kMidiDumpEnd = 2,   /**< the end of a SysEx channel dump */
+  kMidiNrpnValue = 3, /**< a DMX value addressed via a Non-Registered Parameter Number (NRPN) */
+  kMidiNoteOn = 4,    /**< a MIDI Note On with a velocity above zero */
+  kMidiNoteOff = 5    /**< a MIDI Note Off or a MIDI Note On with zero velocity */
+};
+
+const uint8_t kMidiNoteOffStatus = 0x80; /**< the status signature of a MIDI Note Off */
+const uint8_t kMidiNoteOnStatus = 0x90;  /**< the status signature of a MIDI Note On */
+const uint8_t kMidiCcStatus = 0xb0;      /**< the status signature of a MIDI CC */
+
+/**
+ * @brief This struct defines a message decoded from the MIDI input.
+ *
+ */
+struct MidiMessage {
+  MidiEvent event;  /**< the type of the message */
+  uint16_t address; /**< the MIDI CC controller, the MIDI note or the DMX channel */
+  uint8_t value;    /**< the MIDI CC value, the MIDI note velocity or the DMX value */
+};
+
+/**
+ * @brief Normalize the input MIDI channel.
+ *
+ * MIDI nominally uses channels in the range [1, 16]. However, 4-bit values in the range [0, 15] are
+ * transmitted at protocol level. With this function, the input values are normalized and clipped to
+ * the value range of the protocol level.
+ *
+ * @param[in] channel the MIDI channel
+ * @return uint8_t - the normalized MIDI channel in the range [0, 15]
+ */
+inline uint8_t normalizeChannel(const uint8_t channel) {
+  const uint8_t minMidiChannel = 1;
+  const uint8_t maxMidiChannel = 16;
+  return util::max_t(minMidiChannel, util::min_t(maxMidiChannel, channel)) - minMidiChannel;
+}
+
+/**
+ * @brief Check whether the status byte starts a decoded MIDI channel message of the MIDI channel.
+ *
+ * The decoded MIDI channel messages are MIDI CC, MIDI Note On and MIDI Note Off.
+ *
+ * @param[in] channel the normalized MIDI channel in the range [0, 15]
+ * @param[in] status the MIDI status byte
+ * @return true - the \p status byte starts a decoded message of the MIDI \p channel
+ * @return false - otherwise
+ */
+inline bool isChannelMessage(const uint8_t channel, const uint8_t status) {
+  const uint8_t signature = status & 0xf0;
+  return ((status & 0x0f) == channel) &&
+         ((signature == kMidiCcStatus) || (signature == kMidiNoteOnStatus) ||
+          (signature == kMidiNoteOffStatus));
+}
+
+/**
+ * @brief Decode a MIDI channel message, see isChannelMessage().
+ *
+ * @param[in] status the MIDI status byte
+ * @param[in] data1 the first data byte, i.e. the MIDI CC controller or the MIDI note
+ * @param[in] data2 the second data byte, i.e. the MIDI CC value or the MIDI note velocity
+ * @return MidiMessage - the decoded message
+ */
+inline MidiMessage decodeChannelMessage(const uint8_t status, const uint8_t data1,
+                                        const uint8_t data2) {
+  MidiEvent event = kMidiCc;
+
+  if ((status & 0xf0) == kMidiNoteOnStatus) {
+    event = data2 ? kMidiNoteOn : kMidiNoteOff;
+  } else if ((status & 0xf0) == kMidiNoteOffStatus) {
+    event = kMidiNoteOff;
+  }
+
+  return MidiMessage{event, (uint8_t)(data1 & 0x7f), (uint8_t)(data2 & 0x7f)};
+}
+}  // namespace mididmxbridge::midi
+#endif
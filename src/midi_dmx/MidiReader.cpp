@@ -22,64 +22,145 @@
 #include "MidiReader.h"
 
 #include "ISerialReader.h"
-#include "util.h"
+#include "Trace.h"
 
 namespace mididmxbridge::midi {
-using namespace mididmxbridge::util;
+MidiReader::MidiReader(const uint8_t channel, ISerialReader& serial, uint8_t* buffer,
+                       const uint8_t bufferSize, const uint8_t sysExManufacturer,
+                       const uint8_t sysExDevice)
+    : mChannel(normalizeChannel(channel)),
+      mSerial(serial),
+      mBuffer(buffer),
+      mBufferSize(bufferSize),
+      mHead(0),
+      mCount(0),
+      mSysEx(sysExManufacturer, sysExDevice) {}
 
-/**
- * @brief Normalize the input MIDI channel.
- *
- * MIDI nominally uses channels in the range [1, 16]. However, 4-bit values in the range [0, 15] are
- * transmitted at protocol level. With this function, the input values are normalized and clipped to
- * the value range of the protocol level.
- *
- * @param[in] channel the MIDI channel
- * @return uint8_t - the normalized MIDI channel in the range [0, 15]
- */
-static uint8_t normalizeChannel(const uint8_t channel) {
-  const uint8_t minMidiChannel = 1;
-  const uint8_t maxMidiChannel = 16;
-  return max_t(minMidiChannel, min_t(maxMidiChannel, channel)) - minMidiChannel;
+void MidiReader::begin() { mSerial.begin(); }
+
+void MidiReader::fillBuffer() {
+  bool isDrained = false;
+
+  // the free space of the ring buffer consists of at most two contiguous blocks
+  while ((mCount < mBufferSize) && !isDrained) {
+    const uint8_t tail = (mHead + mCount) % mBufferSize;
+    const uint8_t block = (tail < mHead) ? (mHead - tail) : (mBufferSize - tail);
+    const uint8_t received = mSerial.readBytes(&mBuffer[tail], block);
+
+    mCount += received;
+    isDrained = (received < block);
+  }
 }
 
-MidiReader::MidiReader(const uint8_t channel, ISerialReader& serial)
-    : mMidiCcSyncFilter(0xb0 | (0x0f & normalizeChannel(channel))), mSerial(serial) {}
+void MidiReader::dropByte() {
+  if (mCount) {
+    mHead = (mHead + 1 == mBufferSize) ? 0 : mHead + 1;
+    mCount--;
+  }
+}
 
-void MidiReader::begin() { mSerial.begin(); }
+bool MidiReader::sync() {
+  while (mCount && !isChannelMessage(mChannel, mBuffer[mHead]) && (mBuffer[mHead] != kSysExStart)) {
+    MIDIDMXBRIDGE_TRACE_EVENT(util::kTraceMidiResync, mBuffer[mHead], 0);
+    dropByte();
+  }
 
-bool MidiReader::syncCc() {
+  return mCount > 0;
+}
+
+bool MidiReader::readByte(uint8_t& data) {
   bool returnValue = false;
+  const uint8_t byte = mBuffer[mHead];
 
-  while (mSerial.available()) {
-    uint8_t value = (uint8_t)mSerial.read();
+  if (mCount && !(byte & 0x80)) {
+    data = byte;
+    dropByte();
+    returnValue = true;
+  }
 
-    if (value == mMidiCcSyncFilter) {
-      returnValue = true;
-      break;
+  return returnValue;
+}
+
+bool MidiReader::readSysEx(MidiMessage& message) {
+  bool returnValue = false;
+
+  while (!returnValue && mCount && mSysEx.isActive()) {
+    const uint8_t byte = mBuffer[mHead];
+
+    if (byte >= 0xf8) {
+      // real-time messages may be interleaved with SysEx messages
+      dropByte();
+    } else if (byte & 0x80) {
+      // the end byte or any other status byte terminates the SysEx message
+      if (byte == kSysExEnd) {
+        dropByte();
+      }
+      returnValue = mSysEx.stop(message);
+    } else {
+      dropByte();
+      returnValue = mSysEx.decode(byte, message);
     }
   }
 
   return returnValue;
 }
 
-bool MidiReader::readByte(uint8_t& data) {
+bool MidiReader::read(MidiMessage& message) {
   bool returnValue = false;
-  const uint8_t byte = (uint8_t)mSerial.read();
+  bool isComplete = true;
 
-  if (!(byte & 0x80)) {
-    data = byte;
-    returnValue = true;
+  fillBuffer();
+
+  while (!returnValue && isComplete && (mSysEx.isActive() || sync())) {
+    if (mSysEx.isActive()) {
+      returnValue = readSysEx(message);
+      isComplete = (mCount > 0);
+    } else if (mBuffer[mHead] == kSysExStart) {
+      dropByte();
+      mSysEx.start();
+    } else if (mCount >= 3) {
+      const uint8_t status = mBuffer[mHead];
+      uint8_t data1;
+      uint8_t data2;
+
+      dropByte();
+      if (readByte(data1) && readByte(data2)) {
+        message = decodeChannelMessage(status, data1, data2);
+        returnValue = true;
+      }
+    } else {
+      isComplete = false;
+    }
+  }
+
+  if (returnValue) {
+    MIDIDMXBRIDGE_TRACE_EVENT(util::kTraceMidi + message.event, message.address, message.value);
   }
 
   return returnValue;
 }
 
+void MidiReader::wait(const uint16_t timeout_ms) {
+  if (mCount < 3) {
+    mSerial.wait(timeout_ms);
+  }
+}
+
+uint16_t MidiReader::pending() {
+  const int available = mSerial.available();
+  return mCount + ((available > 0) ? available : 0);
+}
+
 bool MidiReader::readCc(uint8_t& controller, uint8_t& value) {
   bool returnValue = false;
+  MidiMessage message;
 
-  if (syncCc() && (mSerial.available() >= 2)) {
-    returnValue = readByte(controller) & readByte(value);
+  while (!returnValue && read(message)) {
+    if (message.event == kMidiCc) {
+      controller = (uint8_t)message.address;
+      value = message.value;
+      returnValue = true;
+    }
   }
 
   return returnValue;
@@ -24,6 +24,10 @@
 
 #include <stdint.h>
 
+#include "MidiMessage.h"
+#include "SysExDecoder.h"
+#include "constants.h"
+
 namespace mididmxbridge {
 class ISerialReader; /**< forward declaration */
 }
@@ -32,9 +36,21 @@ namespace mididmxbridge::midi {
 /**
  * @brief This class defines the reading feature for MIDI data.
  *
+ * The bytes available on the serial interface are transferred into an input buffer first, which is
+ * provided by the owner of the MidiReader object. Incomplete MIDI messages remain in the input
+ * buffer until the missing bytes are received.
+ *
+ * Besides MIDI Continuous Controller (CC) and MIDI Note On/Off messages, DMX channel dumps are
+ * decoded from MIDI System Exclusive (SysEx) messages, see mididmxbridge::midi::SysExDecoder. The
+ * SysEx messages are decoded while they are received, i.e. a dump may exceed the size of the input
+ * buffer.
+ *
  */
 class MidiReader {
  public:
+  using Input = ISerialReader;             /**< the input interface of the reader */
+  static const uint8_t kMinBufferSize = 3; /**< the minimum input buffer size in bytes */
+
   /**
    * @brief Construct a new MidiReader object.
    *
@@ -44,8 +60,15 @@ class MidiReader {
    *
    * @param[in] channel the MIDI channel to listen to in the range [1, 16]
    * @param[in] serial the serial interface
+   * @param[in] buffer the input buffer, which must outlive the MidiReader object
+   * @param[in] bufferSize the size of the input \p buffer in bytes, at least 3
+   * @param[in] sysExManufacturer the SysEx manufacturer ID of channel dumps to accept
+   * @param[in] sysExDevice the SysEx device ID of channel dumps to accept, ::kSysExAllDevices
+   *                        accepts all device IDs
    */
-  MidiReader(const uint8_t channel, ISerialReader& serial);
+  MidiReader(const uint8_t channel, ISerialReader& serial, uint8_t* buffer,
+             const uint8_t bufferSize, const uint8_t sysExManufacturer = kSysExNonCommercialId,
+             const uint8_t sysExDevice = kSysExAllDevices);
 
   /**
    * @brief Destroy the MidiReader object.
@@ -69,32 +92,90 @@ class MidiReader {
    */
   bool readCc(uint8_t& controller, uint8_t& value);
 
+  /**
+   * @brief Read the next MIDI message from the serial interface.
+   *
+   * A SysEx channel dump results in one ::kMidiDumpValue message per DMX value followed by a
+   * ::kMidiDumpEnd message. The ::kMidiDumpEnd message is also emitted if the dump is interrupted
+   * by another MIDI message.
+   *
+   * @param[out] message the next MIDI message
+   * @return true - the \p message got updated
+   * @return false - otherwise
+   */
+  bool read(MidiMessage& message);
+
+  /**
+   * @brief Wait until new MIDI data is available or the timeout expires.
+   *
+   * The function returns immediately if the input buffer still holds a complete MIDI CC message.
+   *
+   * @param[in] timeout_ms the maximum wait time in ms
+   */
+  void wait(const uint16_t timeout_ms);
+
+  /**
+   * @brief Get the number of received MIDI bytes, which are not processed yet.
+   *
+   * @return uint16_t - the number of bytes in the input buffer and on the serial interface
+   */
+  uint16_t pending();
+
  private:
   /**
-   * @brief Search the MIDI Continuous Controller (CC) sync byte.
+   * @brief Search the next MIDI sync byte.
+   *
+   * The sync bytes are the status bytes of the decoded MIDI channel messages, i.e. the or-link
+   * between the MIDI CC, Note On or Note Off signature and the MIDI channel 0x0*, e.g. 0xB5 by
+   * using channel 5, and the SysEx start byte. All bytes preceding a sync byte are discarded from
+   * the input buffer.
    *
-   * The sync byte is the or-link between the MIDI CC signature 0xB0 and the MIDI channel 0x0*, e.g.
-   * 0xB5 by using channel 5.
+   * @return true - a sync byte is located at the front of the input buffer
+   * @return false - otherwise
+   */
+  bool sync();
+
+  /**
+   * @brief Decode the SysEx message bytes located in the input buffer.
    *
-   * @return true - the sync byte was found
+   * @param[out] message the next DMX value or the end of a channel dump
+   * @return true - the \p message got updated
    * @return false - otherwise
    */
-  bool syncCc();
+  bool readSysEx(MidiMessage& message);
 
   /**
-   * @brief Read the next MIDI byte.
+   * @brief Read the next MIDI byte from the input buffer.
    *
-   * The next byte is transferred if it is in the permitted range [0x00, 0x7f]. Otherwise, the
-   * parameter \p data is not modified and `false` is returned.
+   * The next byte is transferred and removed from the input buffer if it is in the permitted range
+   * [0x00, 0x7f]. Otherwise, the parameter \p data is not modified, the byte remains in the input
+   * buffer and `false` is returned.
    *
-   * @param[out] date the next MIDI byte if it is in the range [0x00, 0x7f]
+   * @param[out] data the next MIDI byte if it is in the range [0x00, 0x7f]
    * @return true - the byte is in the allowed range
    * @return false - otherwise
    */
-  bool readByte(uint8_t& date);
+  bool readByte(uint8_t& data);
+
+  /**
+   * @brief Transfer the bytes available on the serial interface into the input buffer.
+   *
+   */
+  void fillBuffer();
+
+  /**
+   * @brief Remove the first byte from the input buffer.
+   *
+   */
+  void dropByte();
 
-  const uint8_t mMidiCcSyncFilter; /**< the MIDI CC sync byte to listen to */
-  ISerialReader& mSerial;          /**< the serial interface */
+  const uint8_t mChannel;    /**< the normalized MIDI channel to listen to */
+  ISerialReader& mSerial;    /**< the serial interface */
+  uint8_t* const mBuffer;    /**< the input buffer */
+  const uint8_t mBufferSize; /**< the size of the input buffer */
+  uint8_t mHead;             /**< the index of the first byte in the input buffer */
+  uint8_t mCount;            /**< the number of bytes in the input buffer */
+  SysExDecoder mSysEx;       /**< the SysEx channel dump decoder */
 };
 }  // namespace mididmxbridge::midi
 #endif
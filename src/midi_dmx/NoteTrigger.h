@@ -0,0 +1,82 @@
+/**
+ * @file NoteTrigger.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::midi::NoteTriggers class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_NOTE_TRIGGER_H__
+#define __MIDIDMXBRIDGE_NOTE_TRIGGER_H__
+
+#include <stdint.h>
+
+#include "ChannelGroupTable.h"
+#include "MidiMessage.h"
+#include "ResponseCurve.h"
+#include "vector.h"
+
+namespace mididmxbridge::midi {
+/**
+ * @brief This class maps MIDI notes onto groups of DMX channels for flash and bump effects.
+ *
+ * A MIDI Note On sets all DMX channels of the group assigned to the note to the level given by the
+ * note velocity, the MIDI Note Off releases them. The groups are kept in a
+ * mididmxbridge::midi::ChannelGroupTable, i.e. triggering costs no search.
+ *
+ * @tparam Slots the number of note triggers, 0 disables the note triggers
+ * @tparam GroupSize the maximum number of DMX channels per note trigger
+ * @tparam Size the number of DMX channels of the universe
+ */
+template <uint8_t Slots, uint8_t GroupSize, uint16_t Size>
+class NoteTriggers {
+ public:
+  /**
+   * @brief Assign the group of DMX channels to the MIDI note.
+   *
+   * A previous assignment of the \p note is replaced. Channels exceeding \p GroupSize are ignored.
+   *
+   * @param[in] note the MIDI note in the range [0, 127]
+   * @param[in] channels the DMX channels triggered by the \p note, each below \p Size
+   * @return true - the group got assigned
+   * @return false - the \p note or a DMX channel is invalid or all note triggers are in use
+   */
+  bool set(const uint8_t note, const vector<uint16_t>& channels) {
+    return mGroups.set(note, channels);
+  }
+
+  /**
+   * @brief Trigger the DMX channels assigned to the note of a MIDI Note On/Off message.
+   *
+   * @tparam F the type of the flash operation, callable via `flash(channel, level)`
+   * @param[in] message the ::kMidiNoteOn or ::kMidiNoteOff message
+   * @param[in] flash the operation setting a DMX channel to the level, level 0 releases it
+   */
+  template <class F>
+  void trigger(const MidiMessage& message, F flash) const {
+    const uint8_t level =
+        (message.event == kMidiNoteOn) ? dmx::applyCurve(dmx::kCurveLinear, message.value) : 0;
+
+    mGroups.forEach(message.address, [&flash, level](const uint16_t channel) {
+      flash(channel, level);
+    });
+  }
+
+ private:
+  ChannelGroupTable<Slots, GroupSize, Size> mGroups; /**< the DMX channels per note */
+};
+}  // namespace mididmxbridge::midi
+#endif
@@ -0,0 +1,142 @@
+/**
+ * @file Nrpn.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::midi::NrpnDecoder class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_MIDI_NRPN_H__
+#define __MIDIDMXBRIDGE_MIDI_NRPN_H__
+
+#include <stdint.h>
+
+#include "MidiMessage.h"
+
+namespace mididmxbridge::midi {
+const uint8_t kCcDataEntryMsb = 6;  /**< the MIDI CC of the data entry MSB */
+const uint8_t kCcDataEntryLsb = 38; /**< the MIDI CC of the data entry LSB */
+const uint8_t kCcNrpnLsb = 98;      /**< the MIDI CC of the NRPN parameter number LSB */
+const uint8_t kCcNrpnMsb = 99;      /**< the MIDI CC of the NRPN parameter number MSB */
+const uint8_t kCcRpnLsb = 100;      /**< the MIDI CC of the RPN parameter number LSB */
+const uint8_t kCcRpnMsb = 101;      /**< the MIDI CC of the RPN parameter number MSB */
+const uint16_t kNrpnNull = 0x3fff;  /**< the NRPN parameter number deselecting the parameter */
+
+/**
+ * @brief This class decodes Non-Registered Parameter Numbers (NRPN) into DMX values.
+ *
+ * The NRPN parameter number selected via CC 99 (MSB) and CC 98 (LSB) addresses the DMX channel, the
+ * data entry via CC 6 (MSB) and CC 38 (LSB) carries the DMX value with a resolution of 14 bits.
+ * This way, all channels of a DMX universe are reachable from MIDI. The selected parameter number
+ * is cached, i.e. repeated data entries to the same channel cost a single CC each.
+ *
+ * The CCs used for the parameter selection and data entry, i.e. CC 6, 38 and 98 to 101, do not
+ * address DMX channels directly while the decoder is enabled. Data entries following a Registered
+ * Parameter Number (RPN) selection or the NRPN null parameter are ignored.
+ *
+ * @tparam Enabled the decoder is enabled if true, all messages are passed unchanged otherwise
+ */
+template <bool Enabled>
+class NrpnDecoder {
+ public:
+  /**
+   * @brief Construct a new NrpnDecoder object without a selected parameter.
+   *
+   */
+  NrpnDecoder() : mParameter(kNrpnNull), mDataMsb(0) {}
+
+  /**
+   * @brief Decode the MIDI message.
+   *
+   * Parameter selections are consumed, data entries are converted into ::kMidiNrpnValue messages
+   * addressing the selected DMX channel. All other messages are passed unchanged.
+   *
+   * @param[in,out] message the MIDI message to decode
+   * @return true - the \p message is to be processed
+   * @return false - the \p message got consumed by the decoder
+   */
+  bool decode(MidiMessage& message) {
+    bool returnValue = true;
+
+    if (message.event == kMidiCc) {
+      switch (message.address) {
+        case kCcNrpnMsb:
+          mParameter = ((uint16_t)message.value << 7) | (mParameter & 0x7f);
+          returnValue = false;
+          break;
+        case kCcNrpnLsb:
+          mParameter = (mParameter & 0x3f80) | message.value;
+          returnValue = false;
+          break;
+        case kCcRpnMsb:
+        case kCcRpnLsb:
+          mParameter = kNrpnNull;
+          returnValue = false;
+          break;
+        case kCcDataEntryMsb:
+          mDataMsb = message.value;
+          returnValue = setValue(message, (mDataMsb << 1) | (mDataMsb >> 6));
+          break;
+        case kCcDataEntryLsb:
+          returnValue = setValue(message, (mDataMsb << 1) | (message.value >> 6));
+          break;
+        default:
+          break;
+      }
+    }
+
+    return returnValue;
+  }
+
+ private:
+  /**
+   * @brief Convert the data entry message into a DMX value of the selected parameter.
+   *
+   * @param[out] message the MIDI message to convert
+   * @param[in] value the DMX value, i.e. the 8 most significant bits of the 14-bit data entry
+   * @return true - a parameter is selected and the \p message got converted
+   * @return false - otherwise
+   */
+  bool setValue(MidiMessage& message, const uint8_t value) const {
+    const bool returnValue = (mParameter != kNrpnNull);
+
+    if (returnValue) {
+      message = {kMidiNrpnValue, mParameter, value};
+    }
+
+    return returnValue;
+  }
+
+  uint16_t mParameter; /**< the selected NRPN parameter number */
+  uint8_t mDataMsb;    /**< the last data entry MSB */
+};
+
+/**
+ * @brief Specialization of NrpnDecoder if the NRPN support is disabled.
+ *
+ */
+template <>
+class NrpnDecoder<false> {
+ public:
+  /**
+   * @brief Pass the MIDI message unchanged.
+   *
+   * @return true - always
+   */
+  bool decode(MidiMessage&) { return true; }
+};
+}  // namespace mididmxbridge::midi
+#endif
@@ -0,0 +1,34 @@
+/**
+ * @file PollWait.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the host wait functions for file descriptors
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "PollWait.h"
+
+#ifndef ARDUINO
+#include <poll.h>
+
+namespace mididmxbridge::util {
+bool waitReadable(const int fd, const uint16_t timeout_ms) {
+  struct pollfd pfd = {fd, POLLIN, 0};
+
+  return (poll(&pfd, 1, timeout_ms) > 0) && (pfd.revents & (POLLIN | POLLHUP | POLLERR));
+}
+}  // namespace mididmxbridge::util
+#endif
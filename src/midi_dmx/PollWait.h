@@ -0,0 +1,44 @@
+/**
+ * @file PollWait.h
+ * @author Christian Neukam
+ * @brief Definition of the host wait functions for file descriptors
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_POLL_WAIT_H__
+#define __MIDIDMXBRIDGE_POLL_WAIT_H__
+
+#ifndef ARDUINO
+#include <stdint.h>
+
+namespace mididmxbridge::util {
+/**
+ * @brief Block until the file descriptor is readable or the timeout expires.
+ *
+ * The function is based on `poll()`, i.e. the calling thread is suspended without burning CPU time
+ * until the kernel signals new input. It is intended for the implementation of
+ * mididmxbridge::ISerialReader::wait() on host systems.
+ *
+ * @param[in] fd the file descriptor to wait for
+ * @param[in] timeout_ms the maximum wait time in ms
+ * @return true - the file descriptor is readable, i.e. data, end of file or an error is pending
+ * @return false - the timeout expired or the wait got interrupted
+ */
+bool waitReadable(const int fd, const uint16_t timeout_ms);
+}  // namespace mididmxbridge::util
+#endif
+#endif
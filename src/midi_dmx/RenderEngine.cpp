@@ -0,0 +1,128 @@
+/**
+ * @file RenderEngine.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::dmx::RenderEngine class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RenderEngine.h"
+
+#ifndef ARDUINO
+#include <chrono>
+
+#include "GainKernel.h"
+#include "util.h"
+
+namespace mididmxbridge::dmx {
+using namespace mididmxbridge::util;
+
+RenderEngine::Universe::Universe(const uint16_t address)
+    : input{},
+      curveTable{},
+      curve(kCurveLinear),
+      gain(kUnityGainValue),
+      targetGain(kUnityGainValue),
+      fadeFrames(0),
+      packet(address) {}
+
+RenderEngine::RenderEngine(const uint16_t universes, const size_t workers)
+    : mPool(workers), mRenderTime(0) {
+  for (uint16_t universe = 0; universe < universes; universe++) {
+    mUniverses.emplace_back(new Universe(universe));
+  }
+}
+
+uint16_t RenderEngine::universes() const { return mUniverses.size(); }
+
+void RenderEngine::setChannel(const uint16_t universe, const uint16_t channel,
+                              const uint8_t value) {
+  if (channel && (channel <= kDmxUniverseSize)) {
+    mUniverses[universe]->input[channel - 1] = value;
+  }
+}
+
+uint8_t* RenderEngine::input(const uint16_t universe) { return mUniverses[universe]->input; }
+
+void RenderEngine::setGain(const uint16_t universe, const uint16_t gain) {
+  fadeGain(universe, gain, 0);
+}
+
+void RenderEngine::fadeGain(const uint16_t universe, const uint16_t gain, const uint16_t frames) {
+  auto& state = *mUniverses[universe];
+
+  state.targetGain = min_t(gain, kUnityGainValue);
+  state.fadeFrames = frames;
+
+  if (!frames) {
+    state.gain = state.targetGain;
+  }
+}
+
+void RenderEngine::setCurve(const uint16_t universe, const DmxCurve curve) {
+  auto& state = *mUniverses[universe];
+
+  // a DMX value maps onto the MIDI resolution of the curve, odd values lie between two points
+  for (uint16_t value = 0; value <= 0xff; value++) {
+    const uint8_t point = value >> 1;
+    const uint8_t lower = applyCurve(curve, point);
+    const uint8_t upper = applyCurve(curve, min_t<uint8_t>(point + 1, kMaxMidiValue));
+
+    state.curveTable[value] = (value & 0x01) ? (lower + upper + 1) >> 1 : lower;
+  }
+
+  state.curve = curve;
+}
+
+ArtNetPacket& RenderEngine::packet(const uint16_t universe) { return mUniverses[universe]->packet; }
+
+void RenderEngine::renderUniverse(const size_t universe) {
+  auto& state = *mUniverses[universe];
+
+  if (state.fadeFrames) {
+    const int32_t step = ((int32_t)state.targetGain - (int32_t)state.gain) / state.fadeFrames;
+
+    state.gain = (--state.fadeFrames) ? state.gain + step : state.targetGain;
+  }
+
+  if (state.curve == kCurveLinear) {
+    scaleUniverse(state.input, state.packet.payload(), kDmxUniverseSize, state.gain);
+  } else {
+    uint8_t* payload = state.packet.payload();
+
+    for (uint16_t idx = 0; idx < kDmxUniverseSize; idx++) {
+      payload[idx] = state.curveTable[state.input[idx]];
+    }
+    scaleUniverse(payload, payload, kDmxUniverseSize, state.gain);
+  }
+  state.packet.nextSequence();
+}
+
+bool RenderEngine::render(const uint32_t deadline) {
+  const auto start = std::chrono::steady_clock::now();
+  auto job = [this](const size_t universe) { renderUniverse(universe); };
+
+  mPool.run(mUniverses.size(), job);
+
+  const auto duration = std::chrono::steady_clock::now() - start;
+  mRenderTime = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+
+  return mRenderTime <= deadline;
+}
+
+uint32_t RenderEngine::renderTime() const { return mRenderTime; }
+}  // namespace mididmxbridge::dmx
+#endif
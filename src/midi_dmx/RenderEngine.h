@@ -0,0 +1,188 @@
+/**
+ * @file RenderEngine.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::RenderEngine class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_RENDER_ENGINE_H__
+#define __MIDIDMXBRIDGE_RENDER_ENGINE_H__
+
+#ifndef ARDUINO
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "ArtNetPacket.h"
+#include "ResponseCurve.h"
+#include "WorkerPool.h"
+#include "constants.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief This class renders many DMX universes in parallel.
+ *
+ * Each universe consists of a raw input buffer, a response curve, a gain with an optional linear
+ * fade and an mididmxbridge::dmx::ArtNetPacket holding the rendered output. Per frame, the
+ * universes are distributed across the workers of a mididmxbridge::util::WorkerPool, idle workers
+ * steal the universes of busy ones. Rendering a universe maps the input via the response curve,
+ * applies the gain via mididmxbridge::dmx::scaleUniverse() directly into the payload of its packet
+ * and advances the sequence number of the packet, so the packets are ready for transmission once
+ * render() returns.
+ *
+ * This class is only available on host systems.
+ *
+ */
+class RenderEngine {
+ public:
+  /**
+   * @brief Construct a new RenderEngine object.
+   *
+   * The Art-Net port address of each packet is initialized with the index of its universe.
+   *
+   * @param[in] universes the number of DMX universes to render
+   * @param[in] workers the number of workers including the calling thread, 0 selects the number of
+   * hardware threads
+   */
+  RenderEngine(const uint16_t universes, const size_t workers = 0);
+
+  /**
+   * @brief Destroy the RenderEngine object.
+   *
+   */
+  virtual ~RenderEngine() = default;
+
+  /**
+   * @brief Get the number of DMX universes.
+   *
+   * @return uint16_t - the number of DMX universes
+   */
+  uint16_t universes() const;
+
+  /**
+   * @brief Set the raw DMX value of a channel.
+   *
+   * Channels outside of the range [1, ::kDmxUniverseSize] are ignored.
+   *
+   * @param[in] universe the index of the universe
+   * @param[in] channel the DMX channel in the range [1, ::kDmxUniverseSize]
+   * @param[in] value the raw DMX value
+   */
+  void setChannel(const uint16_t universe, const uint16_t channel, const uint8_t value);
+
+  /**
+   * @brief Get the raw input buffer of a universe, i.e. the DMX value of channel 1 is located at
+   * index 0.
+   *
+   * @param[in] universe the index of the universe
+   * @return uint8_t* - the raw input buffer with ::kDmxUniverseSize values
+   */
+  uint8_t* input(const uint16_t universe);
+
+  /**
+   * @brief Set the gain of a universe immediately.
+   *
+   * @param[in] universe the index of the universe
+   * @param[in] gain the integer based gain in the range [0, ::kUnityGainValue]
+   */
+  void setGain(const uint16_t universe, const uint16_t gain);
+
+  /**
+   * @brief Fade the gain of a universe linearly to the target value.
+   *
+   * @param[in] universe the index of the universe
+   * @param[in] gain the integer based target gain in the range [0, ::kUnityGainValue]
+   * @param[in] frames the number of frames to reach the target gain
+   */
+  void fadeGain(const uint16_t universe, const uint16_t gain, const uint16_t frames);
+
+  /**
+   * @brief Set the response curve of a universe, which is applied to all its DMX values before the
+   * gain.
+   *
+   * The curves are defined on the MIDI resolution, so the odd DMX values are interpolated between
+   * the neighboring curve points. The linear curve passes the DMX values unchanged.
+   *
+   * @param[in] universe the index of the universe
+   * @param[in] curve the response curve to apply, e.g. ::kCurveGamma for LED dimmers
+   */
+  void setCurve(const uint16_t universe, const DmxCurve curve);
+
+  /**
+   * @brief Get the Art-Net packet holding the rendered output of a universe.
+   *
+   * @param[in] universe the index of the universe
+   * @return ArtNetPacket& - the Art-Net packet
+   */
+  ArtNetPacket& packet(const uint16_t universe);
+
+  /**
+   * @brief Render the next frame of all universes.
+   *
+   * The frame is always rendered completely, so each packet is ready for transmission. The render
+   * time is checked against the \p deadline, see also renderTime().
+   *
+   * @param[in] deadline the time budget of the frame in us
+   * @return true - all universes were rendered within the \p deadline
+   * @return false - the frame exceeded the \p deadline
+   */
+  bool render(const uint32_t deadline);
+
+  /**
+   * @brief Get the render time of the last frame.
+   *
+   * @return uint32_t - the render time in us
+   */
+  uint32_t renderTime() const;
+
+ private:
+  /**
+   * @brief The state of a single DMX universe.
+   *
+   */
+  struct Universe {
+    uint8_t input[kDmxUniverseSize]; /**< the raw DMX values */
+    uint8_t curveTable[0x100];       /**< the response curve indexed by the DMX value */
+    DmxCurve curve;                  /**< the response curve */
+    uint16_t gain;                   /**< the current gain */
+    uint16_t targetGain;             /**< the target gain of the fade */
+    uint16_t fadeFrames;             /**< the remaining frames of the fade */
+    ArtNetPacket packet;             /**< the rendered output */
+
+    /**
+     * @brief Construct a new Universe object.
+     *
+     * @param[in] address the Art-Net port address of the packet
+     */
+    Universe(const uint16_t address);
+  };
+
+  /**
+   * @brief Render the next frame of a single universe.
+   *
+   * @param[in] universe the index of the universe
+   */
+  void renderUniverse(const size_t universe);
+
+  std::vector<std::unique_ptr<Universe>> mUniverses; /**< the DMX universes */
+  util::WorkerPool mPool;                            /**< the workers rendering the universes */
+  uint32_t mRenderTime;                              /**< the render time of the last frame */
+};
+}  // namespace mididmxbridge::dmx
+#endif
+#endif
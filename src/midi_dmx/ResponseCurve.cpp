@@ -0,0 +1,74 @@
+/**
+ * @file ResponseCurve.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the DMX response curves
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ResponseCurve.h"
+
+#include "constants.h"
+#include "pgmspace.h"
+#include "util.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief Tables of the non-linear response curves indexed by the MIDI value.
+ *
+ */
+static const uint8_t kCurveTables[3][kMaxMidiValue + 1] PROGMEM = {
+    /* kCurveGamma */
+    {0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,
+     3,   3,   3,   4,   4,   5,   5,   6,   7,   7,   8,   8,   9,   10,  11,  11,
+     12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  24,  25,  26,  27,  29,
+     30,  31,  33,  34,  36,  37,  39,  40,  42,  44,  45,  47,  49,  51,  53,  55,
+     56,  58,  60,  62,  65,  67,  69,  71,  73,  75,  78,  80,  82,  85,  87,  90,
+     92,  95,  97,  100, 103, 105, 108, 111, 114, 117, 120, 122, 125, 128, 132, 135,
+     138, 141, 144, 147, 151, 154, 157, 161, 164, 168, 171, 175, 179, 182, 186, 190,
+     193, 197, 201, 205, 209, 213, 217, 221, 225, 229, 233, 238, 242, 246, 251, 255},
+    /* kCurveSquare */
+    {0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   3,   3,   4,
+     4,   5,   5,   6,   6,   7,   8,   8,   9,   10,  11,  12,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  22,  23,  24,  25,  27,  28,  29,  31,  32,  33,  35,
+     36,  38,  40,  41,  43,  44,  46,  48,  50,  51,  53,  55,  57,  59,  61,  63,
+     65,  67,  69,  71,  73,  75,  77,  80,  82,  84,  87,  89,  91,  94,  96,  99,
+     101, 104, 106, 109, 112, 114, 117, 120, 122, 125, 128, 131, 134, 137, 140, 143,
+     146, 149, 152, 155, 158, 161, 164, 168, 171, 174, 178, 181, 184, 188, 191, 195,
+     198, 202, 205, 209, 213, 216, 220, 224, 228, 231, 235, 239, 243, 247, 251, 255},
+    /* kCurveSCurve */
+    {0,   1,   1,   1,   1,   1,   2,   2,   3,   4,   4,   5,   6,   7,   9,   10,
+     11,  12,  14,  15,  17,  19,  20,  22,  24,  26,  28,  30,  32,  34,  36,  38,
+     40,  43,  45,  47,  50,  52,  55,  57,  60,  63,  65,  68,  71,  73,  76,  79,
+     82,  85,  87,  90,  93,  96,  99,  102, 105, 108, 111, 114, 117, 120, 123, 126,
+     129, 132, 135, 138, 141, 144, 147, 150, 153, 156, 159, 162, 165, 168, 170, 173,
+     176, 179, 182, 184, 187, 190, 192, 195, 198, 200, 203, 205, 208, 210, 212, 215,
+     217, 219, 221, 223, 225, 227, 229, 231, 233, 235, 236, 238, 240, 241, 243, 244,
+     245, 246, 248, 249, 250, 251, 251, 252, 253, 253, 254, 254, 255, 255, 255, 255}};
+
+uint8_t applyCurve(const DmxCurve curve, const uint8_t value) {
+  const uint8_t midiValue = util::min_t(value, kMaxMidiValue);
+  uint8_t returnValue;
+
+  if (curve == kCurveLinear) {
+    returnValue = (midiValue << 1) | (midiValue >> 6);
+  } else {
+    returnValue = pgm_read_byte(&kCurveTables[(curve & 0x03) - 1][midiValue]);
+  }
+
+  return returnValue;
+}
+}  // namespace mididmxbridge::dmx
@@ -0,0 +1,131 @@
+/**
+ * @file ResponseCurve.h
+ * @author Christian Neukam
+ * @brief Definition of the DMX response curves
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_RESPONSE_CURVE_H__
+#define __MIDIDMXBRIDGE_RESPONSE_CURVE_H__
+
+#include <stdint.h>
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief This enumeration defines the response curves mapping a MIDI value to a DMX value.
+ *
+ * All curves map the MIDI range [0, 127] onto the full DMX range [0, 255].
+ *
+ */
+enum DmxCurve : uint8_t {
+  kCurveLinear = 0, /**< linear response */
+  kCurveGamma = 1,  /**< gamma 2.2 response for the perceived brightness of LEDs */
+  kCurveSquare = 2, /**< square-law response */
+  kCurveSCurve = 3  /**< S-curve response with fine resolution at both ends of the range */
+};
+
+/**
+ * @brief Map a MIDI value to a DMX value via the response curve.
+ *
+ * The non-linear curves are precomputed tables stored in the program memory, i.e. the mapping
+ * costs one table lookup and no floating point arithmetic. Any MIDI value above zero maps to a DMX
+ * value above zero, so a fixture does not switch off before the controller reaches zero.
+ *
+ * @param[in] curve the response curve to apply
+ * @param[in] value the MIDI value in the range [0, 127], larger values are clipped
+ * @return uint8_t - the DMX value in the range [0, 255]
+ */
+uint8_t applyCurve(const DmxCurve curve, const uint8_t value);
+
+/**
+ * @brief This class stores the response curve of each DMX channel.
+ *
+ * The curves are packed with two bits per channel. Channels without an explicitly assigned curve
+ * use mididmxbridge::dmx::kCurveLinear.
+ *
+ * @tparam Size the number of DMX channels
+ */
+template <uint16_t Size>
+class DmxCurves {
+ public:
+  /**
+   * @brief Construct a new DmxCurves object with all channels set to linear.
+   *
+   */
+  DmxCurves() : mCurves() {}
+
+  /**
+   * @brief Get the response curve of the DMX channel.
+   *
+   * @param[in] channel the DMX channel
+   * @return DmxCurve - the response curve of the \p channel, linear if the \p channel is invalid
+   */
+  DmxCurve get(const uint16_t channel) const {
+    uint8_t curve = kCurveLinear;
+
+    if (channel < Size) {
+      curve = (mCurves[channel >> 2] >> ((channel & 0x03) << 1)) & 0x03;
+    }
+
+    return static_cast<DmxCurve>(curve);
+  }
+
+  /**
+   * @brief Set the response curve of the DMX channel.
+   *
+   * The request is ignored if the \p channel exceeds the number of DMX channels.
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] curve the response curve to assign
+   */
+  void set(const uint16_t channel, const DmxCurve curve) {
+    if (channel < Size) {
+      const uint8_t shift = (channel & 0x03) << 1;
+      uint8_t& packed = mCurves[channel >> 2];
+
+      packed = (packed & ~(0x03 << shift)) | ((curve & 0x03) << shift);
+    }
+  }
+
+ private:
+  uint8_t mCurves[(Size + 3) / 4]; /**< the response curves, two bits per channel */
+};
+
+/**
+ * @brief Specialization of DmxCurves if the per-channel response curves are disabled.
+ *
+ * All channels use the linear response curve.
+ *
+ */
+template <>
+class DmxCurves<0> {
+ public:
+  /**
+   * @brief Get the response curve of the DMX channel.
+   *
+   * @return DmxCurve - mididmxbridge::dmx::kCurveLinear always
+   */
+  DmxCurve get(const uint16_t) const { return kCurveLinear; }
+
+  /**
+   * @brief Ignore the request as the per-channel response curves are disabled.
+   *
+   */
+  void set(const uint16_t, const DmxCurve) {}
+};
+}  // namespace mididmxbridge::dmx
+#endif
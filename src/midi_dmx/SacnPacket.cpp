@@ -0,0 +1,109 @@
+/**
+ * @file SacnPacket.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::dmx::SacnPacket class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "SacnPacket.h"
+
+#ifndef ARDUINO
+#include <string.h>
+
+#include "util.h"
+
+namespace mididmxbridge::dmx {
+using namespace mididmxbridge::util;
+
+static const uint8_t kSacnSourceNameSize = 64;   /**< the size of the source name in bytes */
+static const uint8_t kSacnDefaultPriority = 100; /**< the default priority of a source */
+static const uint8_t kSacnSequenceOffset = 111;  /**< the offset of the sequence number */
+
+/**
+ * @brief Write a big endian 16-bit value to the buffer.
+ *
+ * @param[out] buffer the buffer to write to
+ * @param[in] value the value to write
+ */
+static void writeUint16(uint8_t* buffer, const uint16_t value) {
+  buffer[0] = value >> 8;
+  buffer[1] = value & 0xff;
+}
+
+/**
+ * @brief Write a big endian 32-bit value to the buffer.
+ *
+ * @param[out] buffer the buffer to write to
+ * @param[in] value the value to write
+ */
+static void writeUint32(uint8_t* buffer, const uint32_t value) {
+  writeUint16(buffer, value >> 16);
+  writeUint16(buffer + 2, value & 0xffff);
+}
+
+SacnPacket::SacnPacket(const uint16_t universe, const uint8_t* cid, const char* sourceName,
+                       const uint16_t slots)
+    : mSlots(min_t<uint16_t>(max_t<uint16_t>(slots, 1), kDmxUniverseSize)), mData{} {
+  const uint16_t length = kSacnHeaderSize + mSlots;
+
+  // root layer
+  writeUint16(mData + 0, 0x0010);  // preamble size
+  writeUint16(mData + 2, 0x0000);  // postamble size
+  memcpy(mData + 4, "ASC-E1.17\0\0\0", 12);
+  writeUint16(mData + 16, 0x7000 | (length - 16));
+  writeUint32(mData + 18, 0x00000004);  // VECTOR_ROOT_E131_DATA
+  memcpy(mData + 22, cid, kSacnCidSize);
+
+  // framing layer
+  writeUint16(mData + 38, 0x7000 | (length - 38));
+  writeUint32(mData + 40, 0x00000002);  // VECTOR_E131_DATA_PACKET
+  strncpy((char*)mData + 44, sourceName, kSacnSourceNameSize - 1);
+  mData[108] = kSacnDefaultPriority;
+  writeUint16(mData + 109, 0x0000);  // synchronization address
+  mData[kSacnSequenceOffset] = 0;
+  mData[112] = 0x00;  // options
+  setUniverse(universe);
+
+  // DMP layer
+  writeUint16(mData + 115, 0x7000 | (length - 115));
+  mData[117] = 0x02;                     // VECTOR_DMP_SET_PROPERTY
+  mData[118] = 0xa1;                     // address type and data type
+  writeUint16(mData + 119, 0x0000);      // first property address
+  writeUint16(mData + 121, 0x0001);      // address increment
+  writeUint16(mData + 123, mSlots + 1);  // property value count including the start code
+  mData[125] = 0x00;                     // DMX start code
+}
+
+void SacnPacket::setUniverse(const uint16_t universe) { writeUint16(mData + 113, universe); }
+
+void SacnPacket::setPriority(const uint8_t priority) { mData[108] = min_t<uint8_t>(priority, 200); }
+
+void SacnPacket::setChannel(const uint16_t channel, const uint8_t value) {
+  if (channel && (channel <= mSlots)) {
+    mData[kSacnHeaderSize + channel - 1] = value;
+  }
+}
+
+void SacnPacket::nextSequence() { mData[kSacnSequenceOffset]++; }
+
+uint8_t* SacnPacket::payload() { return mData + kSacnHeaderSize; }
+
+const uint8_t* SacnPacket::data() const { return mData; }
+
+uint16_t SacnPacket::size() const { return kSacnHeaderSize + mSlots; }
+}  // namespace mididmxbridge::dmx
+#endif
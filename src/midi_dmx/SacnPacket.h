@@ -0,0 +1,124 @@
+/**
+ * @file SacnPacket.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::SacnPacket class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_SACN_PACKET_H__
+#define __MIDIDMXBRIDGE_SACN_PACKET_H__
+
+#ifndef ARDUINO
+#include <stdint.h>
+
+#include "constants.h"
+
+namespace mididmxbridge::dmx {
+const uint16_t kSacnPort = 5568;     /**< the UDP port of sACN (E1.31) */
+const uint8_t kSacnHeaderSize = 126; /**< the size of the E1.31 header including the start code */
+const uint8_t kSacnCidSize = 16;     /**< the size of the component identifier (CID) in bytes */
+
+/**
+ * @brief This class provides a preformatted sACN (ANSI E1.31) data packet of one DMX universe.
+ *
+ * The DMX values are written directly into the payload of the packet, i.e. the packet is always
+ * ready for transmission. Sending the packet only requires to hand over data() and size() to the
+ * network interface, e.g. `sendto()` of an UDP socket on port ::kSacnPort. After each
+ * transmission nextSequence() shall be called to maintain the sequence number of the packet.
+ *
+ * This class is only available on host systems.
+ *
+ */
+class SacnPacket {
+ public:
+  /**
+   * @brief Construct a new SacnPacket object.
+   *
+   * The number of \p slots is clipped to the range [1, ::kDmxUniverseSize].
+   *
+   * @param[in] universe the sACN universe in the range [1, 63999]
+   * @param[in] cid the unique component identifier (CID) of the source with ::kSacnCidSize bytes
+   * @param[in] sourceName the zero terminated, user readable name of the source
+   * @param[in] slots the number of DMX slots transmitted in the packet
+   */
+  SacnPacket(const uint16_t universe, const uint8_t* cid, const char* sourceName,
+             const uint16_t slots = kDmxUniverseSize);
+
+  /**
+   * @brief Destroy the SacnPacket object.
+   *
+   */
+  virtual ~SacnPacket() = default;
+
+  /**
+   * @brief Set the sACN universe of the packet.
+   *
+   * @param[in] universe the sACN universe in the range [1, 63999]
+   */
+  void setUniverse(const uint16_t universe);
+
+  /**
+   * @brief Set the priority of the source.
+   *
+   * @param[in] priority the priority of the source in the range [0, 200], the default is 100
+   */
+  void setPriority(const uint8_t priority);
+
+  /**
+   * @brief Set the DMX value of the channel in the payload of the packet.
+   *
+   * Channels outside of the range [1, slots] are ignored.
+   *
+   * @param[in] channel the DMX channel in the range [1, slots]
+   * @param[in] value the DMX value
+   */
+  void setChannel(const uint16_t channel, const uint8_t value);
+
+  /**
+   * @brief Increment the sequence number after the packet got transmitted.
+   *
+   */
+  void nextSequence();
+
+  /**
+   * @brief Get the DMX payload of the packet, i.e. the DMX value of slot 1 is located at index 0.
+   *
+   * @return uint8_t* - the DMX payload of the packet
+   */
+  uint8_t* payload();
+
+  /**
+   * @brief Get the raw packet ready for transmission.
+   *
+   * @return const uint8_t* - the raw packet
+   */
+  const uint8_t* data() const;
+
+  /**
+   * @brief Get the size of the raw packet in bytes.
+   *
+   * @return uint16_t - the size of the packet
+   */
+  uint16_t size() const;
+
+ private:
+  uint16_t mSlots;                                   /**< the number of transmitted DMX slots */
+  uint8_t mData[kSacnHeaderSize + kDmxUniverseSize]; /**< the raw packet */
+};
+}  // namespace mididmxbridge::dmx
+#endif
+#endif
@@ -0,0 +1,101 @@
+/**
+ * @file ShowFile.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::dmx::ShowFile class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ShowFile.h"
+
+#include "pgmspace.h"
+
+namespace mididmxbridge::dmx {
+ShowFile::ShowFile() : mData(nullptr), mSize(0), mIsProgmem(false) {}
+
+ShowFile::ShowFile(const uint8_t* data, const uint16_t size, const bool isProgmem)
+    : mData(data), mSize(size), mIsProgmem(isProgmem) {
+  bool isValid = (mData != nullptr) && (mSize >= kShowHeaderSize);
+
+  for (uint8_t idx = 0; isValid && (idx < sizeof(kShowMagic)); idx++) {
+    isValid = (readByte(idx) == kShowMagic[idx]);
+  }
+
+  if (isValid) {
+    const uint32_t tables = (uint32_t)kShowHeaderSize + scenes() * kShowSceneEntrySize +
+                            (((uint32_t)readWord(6) + 3) >> 2);
+
+    isValid = (readByte(4) == kShowVersion) && (readWord(8) == mSize) && (tables <= mSize);
+  }
+
+  if (!isValid) {
+    mData = nullptr;
+    mSize = 0;
+  }
+}
+
+bool ShowFile::isValid() const { return mData != nullptr; }
+
+uint8_t ShowFile::scenes() const { return isValid() ? readByte(5) : 0; }
+
+uint16_t ShowFile::sceneSize(const uint8_t scene) const {
+  uint16_t returnValue = 0;
+
+  if (scene < scenes()) {
+    const uint16_t entry = kShowHeaderSize + scene * kShowSceneEntrySize;
+    const uint16_t count = readWord(entry + 2);
+
+    if ((uint32_t)readWord(entry) + (uint32_t)count * kShowRecordSize <= mSize) {
+      returnValue = count;
+    }
+  }
+
+  return returnValue;
+}
+
+DmxValue ShowFile::sceneValue(const uint8_t scene, const uint16_t index) const {
+  DmxValue returnValue;
+
+  if (index < sceneSize(scene)) {
+    const uint16_t entry = kShowHeaderSize + scene * kShowSceneEntrySize;
+    const uint16_t record = readWord(entry) + index * kShowRecordSize;
+
+    returnValue = DmxValue{readWord(record), readByte(record + 2)};
+  }
+
+  return returnValue;
+}
+
+DmxCurve ShowFile::curve(const uint16_t channel) const {
+  uint8_t curve = kCurveLinear;
+
+  if (isValid() && (channel < readWord(6))) {
+    const uint16_t table = kShowHeaderSize + scenes() * kShowSceneEntrySize;
+
+    curve = (readByte(table + (channel >> 2)) >> ((channel & 0x03) << 1)) & 0x03;
+  }
+
+  return static_cast<DmxCurve>(curve);
+}
+
+uint8_t ShowFile::readByte(const uint16_t offset) const {
+  return mIsProgmem ? pgm_read_byte(mData + offset) : mData[offset];
+}
+
+uint16_t ShowFile::readWord(const uint16_t offset) const {
+  return readByte(offset) | ((uint16_t)readByte(offset + 1) << 8);
+}
+}  // namespace mididmxbridge::dmx
@@ -0,0 +1,199 @@
+/**
+ * @file ShowFile.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::ShowFile class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_SHOW_FILE_H__
+#define __MIDIDMXBRIDGE_SHOW_FILE_H__
+
+#include <stdint.h>
+
+#include "DmxValue.h"
+#include "ResponseCurve.h"
+
+namespace mididmxbridge::dmx {
+const uint8_t kShowMagic[4] = {'M', 'D', 'X', 'S'}; /**< the magic bytes of a show file */
+const uint8_t kShowVersion = 1;                     /**< the supported show file format version */
+const uint8_t kShowHeaderSize = 12;                 /**< the size of the header in bytes */
+const uint8_t kShowSceneEntrySize = 4;              /**< the size of a scene table entry in bytes */
+const uint8_t kShowRecordSize = 3;                  /**< the size of a scene record in bytes */
+
+/**
+ * @brief This class provides read access to a precompiled binary show file.
+ *
+ * A show file holds the static scenes and the response curves of a bridge setup in a flat,
+ * versioned binary layout, which is accessed in place, i.e. without parsing or copying:
+ *
+ * | Offset | Size | Content |
+ * | --- | --- | --- |
+ * | 0 | 4 | magic bytes "MDXS" |
+ * | 4 | 1 | format version, i.e. mididmxbridge::dmx::kShowVersion |
+ * | 5 | 1 | number of scenes S |
+ * | 6 | 2 | number of channels C of the curve table |
+ * | 8 | 2 | total size of the show file in bytes |
+ * | 10 | 2 | reserved, zero |
+ * | 12 | 4 * S | scene table, per scene the offset and the number of its records |
+ * | 12 + 4 * S | (C + 3) / 4 | curve table, two bits per channel as in DmxCurves |
+ * | ... | 3 per record | scene records, the DMX channel (2 bytes) and the DMX value (1 byte) |
+ *
+ * All multi-byte fields are stored little-endian, so the same file is used on all platforms. The
+ * file is either located in RAM, e.g. memory-mapped on host systems, or in the program memory of
+ * AVR boards. The header is checked once on construction, the scene table entries on access.
+ *
+ */
+class ShowFile {
+ public:
+  /**
+   * @brief Construct a new empty, i.e. invalid, ShowFile object.
+   *
+   */
+  ShowFile();
+
+  /**
+   * @brief Construct a new ShowFile object accessing the binary show file.
+   *
+   * The object is invalid if the header of the show file is invalid.
+   *
+   * @param[in] data the show file, which must outlive the ShowFile object
+   * @param[in] size the size of the show file in bytes
+   * @param[in] isProgmem true if the show file is located in the program memory, e.g. via PROGMEM
+   */
+  ShowFile(const uint8_t* data, const uint16_t size, const bool isProgmem = false);
+
+  /**
+   * @brief Check whether the show file got accepted on construction.
+   *
+   * @return true - the show file has the supported format version and a consistent size
+   * @return false - otherwise
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Get the number of scenes of the show file.
+   *
+   * @return uint8_t - the number of scenes
+   */
+  uint8_t scenes() const;
+
+  /**
+   * @brief Get the number of DMX values of the scene.
+   *
+   * @param[in] scene the index of the scene in the range [0, scenes())
+   * @return uint16_t - the number of DMX values, zero if the \p scene is invalid
+   */
+  uint16_t sceneSize(const uint8_t scene) const;
+
+  /**
+   * @brief Get a DMX value of the scene.
+   *
+   * @param[in] scene the index of the scene in the range [0, scenes())
+   * @param[in] index the index of the DMX value in the range [0, sceneSize(scene))
+   * @return DmxValue - the DMX value pair
+   */
+  DmxValue sceneValue(const uint8_t scene, const uint16_t index) const;
+
+  /**
+   * @brief Get the response curve of the DMX channel.
+   *
+   * @param[in] channel the DMX channel
+   * @return DmxCurve - the response curve, linear if the \p channel is not part of the curve table
+   */
+  DmxCurve curve(const uint16_t channel) const;
+
+ private:
+  /**
+   * @brief Read a byte of the show file.
+   *
+   * @param[in] offset the offset of the byte
+   * @return uint8_t - the byte
+   */
+  uint8_t readByte(const uint16_t offset) const;
+
+  /**
+   * @brief Read a little-endian 16-bit field of the show file.
+   *
+   * @param[in] offset the offset of the field
+   * @return uint16_t - the field value
+   */
+  uint16_t readWord(const uint16_t offset) const;
+
+  const uint8_t* mData; /**< the show file, nullptr if invalid */
+  uint16_t mSize;       /**< the size of the show file in bytes */
+  bool mIsProgmem;      /**< true if the show file is located in the program memory */
+};
+
+/**
+ * @brief This class holds the show file loaded into the DMX processing.
+ *
+ * @tparam Enabled true if show files are supported, see \p Config::kShowFile
+ */
+template <bool Enabled>
+class ShowSlot {
+ public:
+  /**
+   * @brief Load the show file if it is valid.
+   *
+   * @param[in] show the show file to load
+   * @return true - the show file got loaded
+   * @return false - the show file is invalid, the previous show file stays loaded
+   */
+  bool load(const ShowFile& show) {
+    const bool isValid = show.isValid();
+
+    if (isValid) {
+      mShow = show;
+    }
+
+    return isValid;
+  }
+
+  /**
+   * @brief Get the loaded show file.
+   *
+   * @return const ShowFile* - the loaded show file, nullptr if none is loaded
+   */
+  const ShowFile* get() const { return mShow.isValid() ? &mShow : nullptr; }
+
+ private:
+  ShowFile mShow; /**< the loaded show file */
+};
+
+/**
+ * @brief Specialization of ShowSlot without show file support.
+ *
+ */
+template <>
+class ShowSlot<false> {
+ public:
+  /**
+   * @brief Reject the show file.
+   *
+   * @return false - always
+   */
+  bool load(const ShowFile&) { return false; }
+
+  /**
+   * @brief Get the loaded show file.
+   *
+   * @return const ShowFile* - nullptr, i.e. no show file is loaded
+   */
+  const ShowFile* get() const { return nullptr; }
+};
+}  // namespace mididmxbridge::dmx
+#endif
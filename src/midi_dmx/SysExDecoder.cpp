@@ -0,0 +1,91 @@
+/**
+ * @file SysExDecoder.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::midi::SysExDecoder class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "SysExDecoder.h"
+
+#include "constants.h"
+
+namespace mididmxbridge::midi {
+SysExDecoder::SysExDecoder(const uint8_t manufacturer, const uint8_t device)
+    : mManufacturer(manufacturer),
+      mDevice(device),
+      mState(kIdle),
+      mMsbs(0),
+      mIndex(0),
+      mChannel(0) {}
+
+void SysExDecoder::start() { mState = kManufacturer; }
+
+bool SysExDecoder::stop(MidiMessage& message) {
+  const bool returnValue = (mState == kData);
+
+  if (returnValue) {
+    message = {kMidiDumpEnd, mChannel, 0};
+  }
+  mState = kIdle;
+
+  return returnValue;
+}
+
+bool SysExDecoder::isActive() const { return mState != kIdle; }
+
+bool SysExDecoder::decode(const uint8_t data, MidiMessage& message) {
+  bool returnValue = false;
+
+  switch (mState) {
+    case kManufacturer:
+      mState = (data == mManufacturer) ? kDevice : kIgnore;
+      break;
+    case kDevice: {
+      const bool isAccepted =
+          (mDevice == kSysExAllDevices) || (data == mDevice) || (data == kSysExAllDevices);
+      mState = isAccepted ? kCommand : kIgnore;
+      break;
+    }
+    case kCommand:
+      mState = (data == kSysExChannelDump) ? kStartMsb : kIgnore;
+      break;
+    case kStartMsb:
+      mChannel = (uint16_t)data << 7;
+      mState = kStartLsb;
+      break;
+    case kStartLsb:
+      mChannel |= data;
+      mIndex = 0;
+      mState = kData;
+      break;
+    case kData:
+      if (mIndex == 0) {
+        mMsbs = data;
+      } else {
+        const uint8_t msb = ((mMsbs >> (mIndex - 1)) & 0x01) << 7;
+        message = {kMidiDumpValue, mChannel++, (uint8_t)(msb | data)};
+        returnValue = true;
+      }
+      mIndex = (mIndex == 7) ? 0 : mIndex + 1;
+      break;
+    default:
+      break;
+  }
+
+  return returnValue;
+}
+}  // namespace mididmxbridge::midi
@@ -0,0 +1,120 @@
+/**
+ * @file SysExDecoder.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::midi::SysExDecoder class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_MIDI_SYSEX_DECODER_H__
+#define __MIDIDMXBRIDGE_MIDI_SYSEX_DECODER_H__
+
+#include <stdint.h>
+
+#include "MidiMessage.h"
+
+namespace mididmxbridge::midi {
+const uint8_t kSysExStart = 0xf0;       /**< the MIDI System Exclusive (SysEx) start byte */
+const uint8_t kSysExEnd = 0xf7;         /**< the MIDI System Exclusive (SysEx) end byte */
+const uint8_t kSysExChannelDump = 0x01; /**< the SysEx command of a DMX channel dump */
+
+/**
+ * @brief This class decodes DMX channel dumps from MIDI System Exclusive (SysEx) messages.
+ *
+ * The SysEx messages have the following layout:
+ *
+ * ```
+ * F0 <manufacturer> <device> 01 <start channel MSB> <start channel LSB> <packed values> F7
+ * ```
+ *
+ * The start channel is a 14-bit value. The DMX values are packed into groups of eight bytes: the
+ * first byte of a group carries the most significant bits of the following (up to) seven values,
+ * bit 0 belonging to the first value. Thereby, 512 DMX values are transferred in 586 data bytes.
+ * The SysEx messages are decoded byte by byte, i.e. a dump does not need to be buffered.
+ *
+ */
+class SysExDecoder {
+ public:
+  /**
+   * @brief Construct a new SysExDecoder object.
+   *
+   * @param[in] manufacturer the SysEx manufacturer ID of channel dumps to accept
+   * @param[in] device the SysEx device ID of channel dumps to accept, ::kSysExAllDevices accepts
+   *                   all device IDs
+   */
+  SysExDecoder(const uint8_t manufacturer, const uint8_t device);
+
+  /**
+   * @brief Start the decoding of a SysEx message, i.e. the SysEx start byte got received.
+   *
+   */
+  void start();
+
+  /**
+   * @brief Stop the decoding of the SysEx message.
+   *
+   * The SysEx message is stopped by the SysEx end byte or by any other status byte except real-time
+   * messages.
+   *
+   * @param[out] message the end of the channel dump
+   * @return true - a channel dump was decoded and the \p message got updated
+   * @return false - otherwise
+   */
+  bool stop(MidiMessage& message);
+
+  /**
+   * @brief Decode the next SysEx data byte.
+   *
+   * @param[in] data the SysEx data byte in the range [0x00, 0x7f]
+   * @param[out] message the next DMX value of a channel dump
+   * @return true - the \p message got updated
+   * @return false - otherwise
+   */
+  bool decode(const uint8_t data, MidiMessage& message);
+
+  /**
+   * @brief Check if a SysEx message is currently decoded.
+   *
+   * @return true - a SysEx message got started but not stopped yet
+   * @return false - otherwise
+   */
+  bool isActive() const;
+
+ private:
+  /**
+   * @brief This enumeration defines the decoding states of a SysEx message.
+   *
+   */
+  enum State : uint8_t {
+    kIdle = 0,         /**< no SysEx message is received */
+    kManufacturer = 1, /**< the manufacturer ID is expected */
+    kDevice = 2,       /**< the device ID is expected */
+    kCommand = 3,      /**< the command is expected */
+    kStartMsb = 4,     /**< the MSB of the start channel is expected */
+    kStartLsb = 5,     /**< the LSB of the start channel is expected */
+    kData = 6,         /**< the packed DMX values are expected */
+    kIgnore = 7        /**< the SysEx message is ignored until its end */
+  };
+
+  const uint8_t mManufacturer; /**< the SysEx manufacturer ID to accept */
+  const uint8_t mDevice;       /**< the SysEx device ID to accept */
+  State mState;                /**< the decoding state of the SysEx message */
+  uint8_t mMsbs;               /**< the most significant bits of the current value group */
+  uint8_t mIndex;              /**< the index of the next byte within the value group */
+  uint16_t mChannel;           /**< the DMX channel of the next dump value */
+};
+}  // namespace mididmxbridge::midi
+#endif
@@ -0,0 +1,61 @@
+/**
+ * @file Trace.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the binary event trace
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Trace.h"
+
+namespace mididmxbridge::util {
+#ifdef MIDIDMXBRIDGE_TRACE
+TraceRecord TraceBuffer::mRecords[MIDIDMXBRIDGE_TRACE_SIZE];
+uint8_t TraceBuffer::mNext = 0;
+#endif
+
+void traceDump(void (*write)(const uint8_t byte)) {
+  uint16_t count = 0;
+
+#ifdef MIDIDMXBRIDGE_TRACE
+  for (uint16_t idx = 0; idx < MIDIDMXBRIDGE_TRACE_SIZE; idx++) {
+    count += (TraceBuffer::mRecords[idx].event != kTraceNone) ? 1 : 0;
+  }
+#endif
+
+  for (uint8_t idx = 0; idx < sizeof(kTraceMagic); idx++) {
+    write(kTraceMagic[idx]);
+  }
+  write(kTraceVersion);
+  write(count & 0xff);
+  write(count >> 8);
+
+#ifdef MIDIDMXBRIDGE_TRACE
+  for (uint16_t idx = 0; idx < MIDIDMXBRIDGE_TRACE_SIZE; idx++) {
+    const uint8_t slot = (TraceBuffer::mNext + idx) & TraceBuffer::kMask;
+    const TraceRecord& record = TraceBuffer::mRecords[slot];
+
+    if (record.event != kTraceNone) {
+      write(record.event);
+      write(record.timestamp & 0xff);
+      write(record.timestamp >> 8);
+      write(record.data0);
+      write(record.data1);
+    }
+  }
+#endif
+}
+}  // namespace mididmxbridge::util
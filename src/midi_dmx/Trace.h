@@ -0,0 +1,122 @@
+/**
+ * @file Trace.h
+ * @author Christian Neukam
+ * @brief Definition of the binary event trace
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_TRACE_H__
+#define __MIDIDMXBRIDGE_TRACE_H__
+
+#include <stdint.h>
+
+#include "Clock.h"
+
+#ifndef MIDIDMXBRIDGE_TRACE_SIZE
+#define MIDIDMXBRIDGE_TRACE_SIZE 32 /**< the number of trace records, a power of two up to 256 */
+#endif
+
+namespace mididmxbridge::util {
+/**
+ * @brief This enumeration defines the events recorded in the trace.
+ *
+ */
+enum TraceEvent : uint8_t {
+  kTraceNone = 0x00,          /**< unused trace record */
+  kTraceMidi = 0x01,          /**< MIDI message, plus MidiEvent: address (low byte), value */
+  kTraceMidiResync = 0x08,    /**< byte dropped while syncing the MIDI input: byte, zero */
+  kTraceDmxUpdate = 0x10,     /**< dynamic scene updated: channel (low byte), value */
+  kTraceDmxUpdateHigh = 0x11, /**< dynamic scene updated, channels above 255 */
+  kTraceScene = 0x20,         /**< scene switched: previous scene, new scene */
+  kTraceGain = 0x21           /**< gain changed: gain (high byte), gain (low byte) */
+};
+
+const uint8_t kTraceMagic[4] = {'M', 'D', 'X', 'T'}; /**< the magic bytes of a trace dump */
+const uint8_t kTraceVersion = 1;                     /**< the version of the trace dump format */
+const uint8_t kTraceRecordSize = 5;                  /**< the size of a dumped record in bytes */
+
+/**
+ * @brief This structure defines a trace record.
+ *
+ */
+struct TraceRecord {
+  uint16_t timestamp; /**< the time of the event in ms, wraps around */
+  uint8_t event;      /**< the event id, see mididmxbridge::util::TraceEvent */
+  uint8_t data0;      /**< the first payload byte */
+  uint8_t data1;      /**< the second payload byte */
+};
+
+/**
+ * @brief Write the trace as binary dump, oldest record first.
+ *
+ * The dump consists of the magic bytes "MDXT", the format version, the number of records as 16-bit
+ * little-endian value and the records, each with the event id, the 16-bit little-endian timestamp
+ * and both payload bytes. The dump is decoded on host systems via the `extras/tracedump` tool. If
+ * the trace is compiled out, the dump contains no records.
+ *
+ * @param[in] write the function writing a byte of the dump, e.g. to the serial interface
+ */
+void traceDump(void (*write)(const uint8_t byte));
+
+#ifdef MIDIDMXBRIDGE_TRACE
+static_assert((MIDIDMXBRIDGE_TRACE_SIZE & (MIDIDMXBRIDGE_TRACE_SIZE - 1)) == 0,
+              "the trace size must be a power of two");
+static_assert(MIDIDMXBRIDGE_TRACE_SIZE <= 256, "the trace size must not exceed 256");
+
+/**
+ * @brief This class holds the trace ring buffer.
+ *
+ * The oldest record is overwritten once the buffer is full. Events must be recorded from a single
+ * context only, e.g. the main loop.
+ *
+ */
+class TraceBuffer {
+ public:
+  static const uint8_t kMask = MIDIDMXBRIDGE_TRACE_SIZE - 1; /**< masks the record index */
+
+  static TraceRecord mRecords[MIDIDMXBRIDGE_TRACE_SIZE]; /**< the trace records */
+  static uint8_t mNext;                                  /**< the index of the next record */
+};
+
+/**
+ * @brief Record the event in the trace.
+ *
+ * @param[in] event the event id, see mididmxbridge::util::TraceEvent
+ * @param[in] data0 the first payload byte
+ * @param[in] data1 the second payload byte
+ */
+inline void trace(const uint8_t event, const uint8_t data0, const uint8_t data1) {
+  TraceRecord& record = TraceBuffer::mRecords[TraceBuffer::mNext];
+
+  TraceBuffer::mNext = (TraceBuffer::mNext + 1) & TraceBuffer::kMask;
+  record = {clockMs(), event, data0, data1};
+}
+#endif
+}  // namespace mididmxbridge::util
+
+/**
+ * @brief Record the event in the trace if the trace is enabled via `MIDIDMXBRIDGE_TRACE`,
+ * otherwise the macro compiles to nothing.
+ *
+ */
+#ifdef MIDIDMXBRIDGE_TRACE
+#define MIDIDMXBRIDGE_TRACE_EVENT(event, data0, data1) \
+  mididmxbridge::util::trace((event), (uint8_t)(data0), (uint8_t)(data1))
+#else
+#define MIDIDMXBRIDGE_TRACE_EVENT(event, data0, data1) ((void)0)
+#endif
+#endif
@@ -0,0 +1,146 @@
+/**
+ * @file UsbMidiReader.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::midi::UsbMidiReader class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "UsbMidiReader.h"
+
+#include "IPacketReader.h"
+#include "Trace.h"
+
+namespace mididmxbridge::midi {
+const uint8_t kCinSysExStart = 0x04; /**< SysEx starts or continues with three bytes */
+const uint8_t kCinSysExEnd1 = 0x05;  /**< SysEx ends with one byte or system common message */
+const uint8_t kCinSysExEnd2 = 0x06;  /**< SysEx ends with two bytes */
+const uint8_t kCinSysExEnd3 = 0x07;  /**< SysEx ends with three bytes */
+const uint8_t kCinSingleByte = 0x0f; /**< single byte, e.g. real-time message */
+
+UsbMidiReader::UsbMidiReader(const uint8_t channel, IPacketReader& input, uint8_t* buffer,
+                             const uint8_t bufferSize, const uint8_t sysExManufacturer,
+                             const uint8_t sysExDevice)
+    : mChannel(normalizeChannel(channel)),
+      mInput(input),
+      mBuffer(buffer),
+      mBufferSize(bufferSize / kUsbMidiPacketSize),
+      mIndex(0),
+      mCount(0),
+      mByte(1),
+      mSysEx(sysExManufacturer, sysExDevice) {}
+
+void UsbMidiReader::begin() { mInput.begin(); }
+
+bool UsbMidiReader::fillBuffer() {
+  if (mIndex >= mCount) {
+    mCount = mInput.read(mBuffer, mBufferSize);
+    mIndex = 0;
+    mByte = 1;
+  }
+
+  return mIndex < mCount;
+}
+
+void UsbMidiReader::dropPacket() {
+  mIndex++;
+  mByte = 1;
+}
+
+bool UsbMidiReader::readSysEx(const uint8_t* packet, const uint8_t size, MidiMessage& message) {
+  bool returnValue = false;
+
+  while (!returnValue && (mByte <= size)) {
+    const uint8_t byte = packet[mByte++];
+
+    if (byte == kSysExStart) {
+      mSysEx.start();
+    } else if (byte & 0x80) {
+      // the end byte or a system common message terminates the SysEx message
+      returnValue = mSysEx.stop(message);
+    } else if (mSysEx.isActive()) {
+      returnValue = mSysEx.decode(byte, message);
+    }
+  }
+
+  if (mByte > size) {
+    dropPacket();
+  }
+
+  return returnValue;
+}
+
+bool UsbMidiReader::read(MidiMessage& message) {
+  bool returnValue = false;
+
+  while (!returnValue && fillBuffer()) {
+    const uint8_t* packet = &mBuffer[mIndex * kUsbMidiPacketSize];
+    const uint8_t cin = packet[0] & 0x0f;
+
+    if (cin == kCinSysExStart || cin == kCinSysExEnd3) {
+      returnValue = readSysEx(packet, 3, message);
+    } else if (cin == kCinSysExEnd2) {
+      returnValue = readSysEx(packet, 2, message);
+    } else if (cin == kCinSysExEnd1) {
+      returnValue = readSysEx(packet, 1, message);
+    } else if (mSysEx.isActive() && (cin != kCinSingleByte)) {
+      // any message except real-time messages terminates the SysEx message
+      returnValue = mSysEx.stop(message);
+    } else {
+      // the CIN of a channel message equals the upper nibble of its status byte
+      if ((cin == (packet[1] >> 4)) && isChannelMessage(mChannel, packet[1])) {
+        message = decodeChannelMessage(packet[1], packet[2], packet[3]);
+        returnValue = true;
+      }
+      dropPacket();
+    }
+  }
+
+  if (returnValue) {
+    MIDIDMXBRIDGE_TRACE_EVENT(util::kTraceMidi + message.event, message.address, message.value);
+  }
+
+  return returnValue;
+}
+
+void UsbMidiReader::wait(const uint16_t timeout_ms) {
+  if (mIndex >= mCount) {
+    mInput.wait(timeout_ms);
+  }
+}
+
+uint16_t UsbMidiReader::pending() {
+  const uint32_t buffered = (mIndex < mCount) ? (mCount - mIndex) : 0;
+  const uint32_t bytes = (buffered + mInput.available()) * kUsbMidiPacketSize;
+
+  return (bytes < 0xffff) ? (uint16_t)bytes : 0xffff;
+}
+
+bool UsbMidiReader::readCc(uint8_t& controller, uint8_t& value) {
+  bool returnValue = false;
+  MidiMessage message;
+
+  while (!returnValue && read(message)) {
+    if (message.event == kMidiCc) {
+      controller = (uint8_t)message.address;
+      value = message.value;
+      returnValue = true;
+    }
+  }
+
+  return returnValue;
+}
+}  // namespace mididmxbridge::midi
@@ -0,0 +1,160 @@
+/**
+ * @file UsbMidiReader.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::midi::UsbMidiReader class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_USB_MIDI_READER_H__
+#define __MIDIDMXBRIDGE_USB_MIDI_READER_H__
+
+#include <stdint.h>
+
+#include "IPacketReader.h"
+#include "MidiMessage.h"
+#include "SysExDecoder.h"
+#include "constants.h"
+
+namespace mididmxbridge::midi {
+/**
+ * @brief This class defines the reading feature for USB-MIDI event packets.
+ *
+ * The packets are read in batches into an input buffer, which is provided by the owner of the
+ * UsbMidiReader object. As each packet carries a complete MIDI message and its Code Index Number
+ * (CIN), the MIDI messages are decoded without scanning the byte stream for sync bytes. The packets
+ * of all virtual cables are accepted.
+ *
+ * Besides MIDI Continuous Controller (CC) and MIDI Note On/Off messages, DMX channel dumps are
+ * decoded from MIDI System Exclusive (SysEx) messages, see mididmxbridge::midi::SysExDecoder.
+ *
+ */
+class UsbMidiReader {
+ public:
+  using Input = IPacketReader;                              /**< the input interface */
+  static const uint8_t kMinBufferSize = kUsbMidiPacketSize; /**< the minimum buffer size in bytes */
+
+  /**
+   * @brief Construct a new UsbMidiReader object.
+   *
+   * As MIDI channels are usually 1-indexed and therefore cover a value range of [1, 16] with a
+   * 4-bit resolution, this nominal value is also used here. If this value range is exceeded, the
+   * channel is clipped to the next limit, e.g. 0 -> 1 or 17 -> 16.
+   *
+   * @param[in] channel the MIDI channel to listen to in the range [1, 16]
+   * @param[in] input the USB-MIDI packet interface
+   * @param[in] buffer the input buffer, which must outlive the UsbMidiReader object
+   * @param[in] bufferSize the size of the input \p buffer in bytes, at least one packet, i.e.
+   *                       ::kUsbMidiPacketSize bytes
+   * @param[in] sysExManufacturer the SysEx manufacturer ID of channel dumps to accept
+   * @param[in] sysExDevice the SysEx device ID of channel dumps to accept, ::kSysExAllDevices
+   *                        accepts all device IDs
+   */
+  UsbMidiReader(const uint8_t channel, IPacketReader& input, uint8_t* buffer,
+                const uint8_t bufferSize, const uint8_t sysExManufacturer = kSysExNonCommercialId,
+                const uint8_t sysExDevice = kSysExAllDevices);
+
+  /**
+   * @brief Destroy the UsbMidiReader object.
+   *
+   */
+  virtual ~UsbMidiReader() = default;
+
+  /**
+   * @brief Initialize the UsbMidiReader object.
+   *
+   */
+  void begin();
+
+  /**
+   * @brief Read the next MIDI Continuous Controller (CC) from the USB-MIDI interface.
+   *
+   * @param[out] controller the MIDI CC controller, i.e. the second MIDI byte
+   * @param[out] value the MIDI CC controller value, i.e. the third MIDI byte
+   * @return true - the \p controller and \p value got updated
+   * @return false - otherwise
+   */
+  bool readCc(uint8_t& controller, uint8_t& value);
+
+  /**
+   * @brief Read the next MIDI message from the USB-MIDI interface.
+   *
+   * A SysEx channel dump results in one ::kMidiDumpValue message per DMX value followed by a
+   * ::kMidiDumpEnd message. The ::kMidiDumpEnd message is also emitted if the dump is interrupted
+   * by another MIDI message.
+   *
+   * @param[out] message the next MIDI message
+   * @return true - the \p message got updated
+   * @return false - otherwise
+   */
+  bool read(MidiMessage& message);
+
+  /**
+   * @brief Wait until new USB-MIDI packets are available or the timeout expires.
+   *
+   * The function returns immediately if the input buffer still holds unprocessed packets.
+   *
+   * @param[in] timeout_ms the maximum wait time in ms
+   */
+  void wait(const uint16_t timeout_ms);
+
+  /**
+   * @brief Get the number of received MIDI bytes, which are not processed yet.
+   *
+   * @return uint16_t - the number of bytes of the unprocessed packets in the input buffer and
+   *                    of the unread packets of the input, see IPacketReader::available()
+   */
+  uint16_t pending();
+
+ private:
+  /**
+   * @brief Read the next batch of packets into the input buffer once all packets are processed.
+   *
+   * @return true - unprocessed packets are available in the input buffer
+   * @return false - otherwise
+   */
+  bool fillBuffer();
+
+  /**
+   * @brief Continue with the next packet in the input buffer.
+   *
+   */
+  void dropPacket();
+
+  /**
+   * @brief Decode the SysEx bytes of the current packet.
+   *
+   * The packet is dropped once all of its bytes are decoded.
+   *
+   * @param[in] packet the current packet
+   * @param[in] size the number of MIDI bytes carried by the \p packet
+   * @param[out] message the next DMX value or the end of a channel dump
+   * @return true - the \p message got updated
+   * @return false - otherwise
+   */
+  bool readSysEx(const uint8_t* packet, const uint8_t size, MidiMessage& message);
+
+  const uint8_t mChannel;    /**< the normalized MIDI channel to listen to */
+  IPacketReader& mInput;     /**< the USB-MIDI packet interface */
+  uint8_t* const mBuffer;    /**< the input buffer */
+  const uint8_t mBufferSize; /**< the capacity of the input buffer in packets */
+  uint8_t mIndex;            /**< the index of the current packet in the input buffer */
+  uint8_t mCount;            /**< the number of packets in the input buffer */
+  uint8_t mByte;             /**< the index of the next MIDI byte within the current packet */
+  SysExDecoder mSysEx;       /**< the SysEx channel dump decoder */
+};
+}  // namespace mididmxbridge::midi
+#endif
@@ -0,0 +1,130 @@
+/**
+ * @file WorkerPool.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::util::WorkerPool class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "WorkerPool.h"
+
+#ifndef ARDUINO
+#include <algorithm>
+
+namespace mididmxbridge::util {
+WorkerPool::WorkerPool(const size_t workers)
+    : mJob(nullptr), mContext(nullptr), mWorkers(0), mRunning(0), mBatch(0), mStop(false) {
+  const size_t count = workers ? workers : std::max(1u, std::thread::hardware_concurrency());
+
+  mRanges.reset(new Range[count]);
+
+  for (size_t worker = 1; worker < count; worker++) {
+    mWake.emplace_back(new std::condition_variable);
+  }
+
+  for (size_t worker = 1; worker < count; worker++) {
+    mThreads.emplace_back(&WorkerPool::workerLoop, this, worker);
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStop = true;
+  }
+
+  for (auto& wake : mWake) {
+    wake->notify_one();
+  }
+
+  for (auto& thread : mThreads) {
+    thread.join();
+  }
+}
+
+size_t WorkerPool::size() const { return mThreads.size() + 1; }
+
+void WorkerPool::run(const size_t count, const Job job, void* context) {
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mJob = job;
+    mContext = context;
+    mWorkers = std::max<size_t>(1, std::min(size(), count));
+    mRunning = mWorkers - 1;
+
+    for (size_t worker = 0; worker < mWorkers; worker++) {
+      mRanges[worker].next.store(count * worker / mWorkers, std::memory_order_relaxed);
+      mRanges[worker].end = count * (worker + 1) / mWorkers;
+    }
+    mBatch++;
+  }
+
+  for (size_t worker = 1; worker < mWorkers; worker++) {
+    mWake[worker - 1]->notify_one();
+  }
+
+  processJobs(0);
+
+  std::unique_lock<std::mutex> lock(mMutex);
+  mDone.wait(lock, [this] { return mRunning == 0; });
+}
+
+void WorkerPool::workerLoop(const size_t worker) {
+  uint64_t batch = 0;
+
+  while (true) {
+    {
+      const auto isWoken = [this, worker, batch] {
+        return mStop || ((mBatch != batch) && (worker < mWorkers));
+      };
+      std::unique_lock<std::mutex> lock(mMutex);
+
+      mWake[worker - 1]->wait(lock, isWoken);
+
+      if (mStop) {
+        break;
+      }
+
+      batch = mBatch;
+    }
+
+    processJobs(worker);
+
+    bool isLast = false;
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      isLast = (--mRunning == 0);
+    }
+
+    if (isLast) {
+      mDone.notify_one();
+    }
+  }
+}
+
+void WorkerPool::processJobs(const size_t worker) {
+  // the batch state is published via the mutex, the jobs are only distributed via the counters
+  for (size_t offset = 0; offset < mWorkers; offset++) {
+    Range& range = mRanges[(worker + offset) % mWorkers];
+
+    for (size_t job = range.next.fetch_add(1, std::memory_order_relaxed); job < range.end;
+         job = range.next.fetch_add(1, std::memory_order_relaxed)) {
+      mJob(mContext, job);
+    }
+  }
+}
+}  // namespace mididmxbridge::util
+#endif
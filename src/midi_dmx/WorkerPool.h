@@ -0,0 +1,143 @@
+/**
+ * @file WorkerPool.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::util::WorkerPool class
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_WORKER_POOL_H__
+#define __MIDIDMXBRIDGE_WORKER_POOL_H__
+
+#ifndef ARDUINO
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mididmxbridge::util {
+/**
+ * @brief This class provides a pool of worker threads processing batches of jobs.
+ *
+ * The jobs of a batch are split into one contiguous range per worker. A worker takes the jobs of
+ * its own range via an atomic counter, i.e. one uncontended atomic increment per job. Once its
+ * range is exhausted, the worker steals the remaining jobs of the other ranges via their counters,
+ * so a slow job or a preempted worker does not stall the batch. Only the workers with a non-empty
+ * range are woken, and the batch completes with a single barrier. The calling thread participates
+ * as the first worker.
+ *
+ * This class is only available on host systems.
+ *
+ */
+class WorkerPool {
+ public:
+  /**
+   * @brief Signature of a job, which receives the context and the index of the job within the
+   * batch.
+   *
+   */
+  using Job = void (*)(void* context, const size_t index);
+
+  /**
+   * @brief Construct a new WorkerPool object.
+   *
+   * @param[in] workers the number of workers including the calling thread, 0 selects the number of
+   * hardware threads
+   */
+  WorkerPool(const size_t workers = 0);
+
+  /**
+   * @brief Destroy the WorkerPool object.
+   *
+   * All worker threads are joined.
+   *
+   */
+  virtual ~WorkerPool();
+
+  /**
+   * @brief Run a batch of jobs and wait for its completion.
+   *
+   * @param[in] count the number of jobs of the batch
+   * @param[in] job the job to run for each index in the range [0, count)
+   * @param[in] context the context passed to each \p job
+   */
+  void run(const size_t count, const Job job, void* context);
+
+  /**
+   * @brief Run a batch of jobs given as callable object and wait for its completion.
+   *
+   * @tparam F the type of the job, callable via `job(index)`
+   * @param[in] count the number of jobs of the batch
+   * @param[in] job the job to run for each index in the range [0, count)
+   */
+  template <class F>
+  void run(const size_t count, F& job) {
+    run(count, [](void* context, const size_t index) { (*static_cast<F*>(context))(index); },
+        &job);
+  }
+
+  /**
+   * @brief Get the number of workers including the calling thread.
+   *
+   * @return size_t - the number of workers
+   */
+  size_t size() const;
+
+ private:
+  /**
+   * @brief The range of jobs of a worker, aligned to a cache line to avoid false sharing.
+   *
+   */
+  struct alignas(64) Range {
+    std::atomic<size_t> next; /**< the next job to take, may exceed the end */
+    size_t end;               /**< the end of the range */
+  };
+
+  /**
+   * @brief The processing loop of a worker thread.
+   *
+   * @param[in] worker the index of the worker
+   */
+  void workerLoop(const size_t worker);
+
+  /**
+   * @brief Process the range of jobs of the current batch assigned to the worker, then steal the
+   * remaining jobs of the other workers.
+   *
+   * @param[in] worker the index of the worker
+   */
+  void processJobs(const size_t worker);
+
+  std::vector<std::thread> mThreads;                          /**< the worker threads */
+  std::vector<std::unique_ptr<std::condition_variable>> mWake; /**< wakes a worker thread */
+  std::unique_ptr<Range[]> mRanges;                           /**< the job range per worker */
+  std::mutex mMutex;                                          /**< the lock of the batch state */
+  std::condition_variable mDone;                              /**< signals the batch completion */
+  Job mJob;                                                   /**< the job of the current batch */
+  void* mContext;                                             /**< the context of the job */
+  size_t mWorkers;                                            /**< the workers of the batch */
+  size_t mRunning;                                            /**< the busy worker threads */
+  uint64_t mBatch;                                            /**< the current batch number */
+  bool mStop;                                                 /**< terminates the threads */
+};
+}  // namespace mididmxbridge::util
+#endif
+#endif
@@ -0,0 +1,81 @@
+/**
+ * @file atomic.h
+ * @author Christian Neukam
+ * @brief Definition of atomic access helpers for data shared with interrupts and threads
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_ATOMIC_H__
+#define __MIDIDMXBRIDGE_ATOMIC_H__
+
+#include <stdint.h>
+
+#ifdef __AVR__
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#endif
+
+namespace mididmxbridge::util {
+/**
+ * @brief Load the shared byte atomically.
+ *
+ * @param[in] shared the byte shared between contexts
+ * @return uint8_t - the value of the byte
+ */
+inline uint8_t atomicLoad(const volatile uint8_t& shared) {
+#ifdef __AVR__
+  return shared;
+#else
+  return __atomic_load_n(&shared, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/**
+ * @brief Store the shared byte atomically.
+ *
+ * @param[out] shared the byte shared between contexts
+ * @param[in] value the value to store
+ */
+inline void atomicStore(volatile uint8_t& shared, const uint8_t value) {
+#ifdef __AVR__
+  shared = value;
+#else
+  __atomic_store_n(&shared, value, __ATOMIC_RELEASE);
+#endif
+}
+
+/**
+ * @brief Exchange the shared byte atomically.
+ *
+ * @param[in,out] shared the byte shared between contexts
+ * @param[in] value the value to store
+ * @return uint8_t - the previous value of the byte
+ */
+inline uint8_t atomicExchange(volatile uint8_t& shared, const uint8_t value) {
+#ifdef __AVR__
+  const uint8_t sreg = SREG;
+  cli();
+  const uint8_t previous = shared;
+  shared = value;
+  SREG = sreg;
+  return previous;
+#else
+  return __atomic_exchange_n(&shared, value, __ATOMIC_ACQ_REL);
+#endif
+}
+}  // namespace mididmxbridge::util
+#endif
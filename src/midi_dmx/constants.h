@@ -28,5 +28,8 @@ namespace mididmxbridge {
 const uint8_t kMaxMidiValue = 0x7f;                      /**< maximum possible MIDI value */
 const uint8_t kAnalogReadBits = 10;                      /**< bit resolution of analog read */
 const uint16_t kUnityGainValue = (1 << kAnalogReadBits); /**< factor for unity gain */
+const uint16_t kDmxUniverseSize = 512;                   /**< number of slots of a DMX universe */
+const uint8_t kSysExNonCommercialId = 0x7d;              /**< non-commercial SysEx ID */
+const uint8_t kSysExAllDevices = 0x7f;                   /**< SysEx ID of all devices */
 }  // namespace mididmxbridge
 #endif
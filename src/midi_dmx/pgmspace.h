@@ -0,0 +1,38 @@
+/**
+ * @file pgmspace.h
+ * @author Christian Neukam
+ * @brief Portable access to constant data stored in the program memory.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright 2026 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_PGMSPACE_H__
+#define __MIDIDMXBRIDGE_PGMSPACE_H__
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stdint.h>
+
+#ifndef PROGMEM
+#define PROGMEM /**< constant data is not moved to a separate memory on host systems */
+#endif
+
+#ifndef pgm_read_byte
+#define pgm_read_byte(address) (*(const uint8_t*)(address)) /**< read a byte from PROGMEM */
+#endif
+#endif
+#endif
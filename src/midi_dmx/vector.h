@@ -32,8 +32,9 @@ namespace mididmxbridge {
  * @warning This class is not standard compliant.
  *
  * @tparam T - The type of the elements.
+ * @tparam MaxCapacity - The maximum capacity of the container, shall be < 256.
  */
-template <class T>
+template <class T, uint8_t MaxCapacity = 128>
 class vector {
  public:
   /**
@@ -56,16 +57,16 @@ class vector {
    * @param count the size of the container
    */
   vector(const uint8_t count) {
-    if (count < mMaxCapacity) {
+    if (count < MaxCapacity) {
       mSize = count;
 
       while (mSize > mCapacity) {
-        mCapacity *= 2;
+        mCapacity = (mCapacity < (MaxCapacity >> 1)) ? mCapacity << 1 : MaxCapacity;
       }
 
     } else {
-      mSize = mMaxCapacity;
-      mCapacity = mMaxCapacity;
+      mSize = MaxCapacity;
+      mCapacity = MaxCapacity;
     }
 
     mData = new T[mCapacity];
@@ -149,7 +150,7 @@ class vector {
    *
    * @return uint8_t - the maximum number of elements.
    */
-  uint8_t max_size() const { return mMaxCapacity; }
+  uint8_t max_size() const { return MaxCapacity; }
 
   /**
    * @brief Returns the number of elements that the container has currently allocated space for.
@@ -177,7 +178,7 @@ class vector {
    *
    */
   void resize() {
-    const uint8_t newCapacity = (mCapacity < (mMaxCapacity >> 1)) ? mCapacity << 1 : mMaxCapacity;
+    const uint8_t newCapacity = (mCapacity < (MaxCapacity >> 1)) ? mCapacity << 1 : MaxCapacity;
 
     if (newCapacity != mCapacity) {
       auto data = new T[newCapacity];
@@ -186,16 +187,15 @@ class vector {
         data[idx] = mData[idx];
       }
 
-      delete mData;
+      delete[] mData;
       mData = data;
       mCapacity = newCapacity;
     }
   }
 
-  const uint8_t mMaxCapacity = 128; /**< the maximum capacity, shall be < 256 */
-  T* mData;                         /**< the raw data array */
-  uint8_t mSize = 0;                /**< the current size of the container */
-  uint8_t mCapacity = 16;           /**< the current capacity of the container */
+  T* mData;                                                  /**< the raw data array */
+  uint8_t mSize = 0;                                         /**< the current size */
+  uint8_t mCapacity = (MaxCapacity < 16) ? MaxCapacity : 16; /**< the current capacity */
 };
 }  // namespace mididmxbridge
 #endif